@@ -0,0 +1,207 @@
+// Headless rendering benchmark for the UI screens.
+//
+// Drives the screens into an sf::RenderTexture with scripted input and board
+// states and reports, per scenario, the CPU time of a frame (render + display),
+// the number of draw calls and the number of heap allocations it makes.
+//
+// Usage: SudokuBench [frames per scenario] [font path]
+
+#include "ScreenManager.h"
+#include "RenderStats.h"
+#include "../SudokuLib/ISudokuGame.h"
+#include "../SudokuLib/PerfStats.h"
+#define ALLOCATION_COUNTER_IMPLEMENTATION
+#include "../SudokuLib/AllocationCounter.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ---- Scenarios --------------------------------------------------------------
+
+namespace {
+
+constexpr unsigned int WIDTH = 700;
+constexpr unsigned int HEIGHT = 750;
+
+// Board geometry used by GameScreen.
+constexpr int CELL_SIZE = 60;
+constexpr int BOARD_X = 50;
+constexpr int BOARD_Y = 80;
+
+struct FrameSample {
+    double micros;
+    std::size_t drawCalls;
+    std::size_t allocations;
+};
+
+struct Scenario {
+    std::string name;
+    // Prepares the manager (screen, game) before the first frame.
+    std::function<bool(ScreenManager&, sf::RenderTarget&)> setup;
+    // Scripted input applied before frame n; not part of the measured time.
+    std::function<void(ScreenManager&, int n)> input;
+};
+
+bool startGame(ScreenManager& manager, sf::RenderTarget& target) {
+    manager.createGame(Difficulty::MEDIUM, target);
+
+    // The game is generated in the background and installed by applyPending().
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!manager.getGame() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        manager.applyPending(target);
+    }
+    return manager.getGame() != nullptr;
+}
+
+void clickCell(IScreen& screen, int row, int col) {
+    screen.handleMouseClick(BOARD_X + col * CELL_SIZE + CELL_SIZE / 2, BOARD_Y + row * CELL_SIZE + CELL_SIZE / 2);
+}
+
+std::vector<Scenario> buildScenarios() {
+    std::vector<Scenario> scenarios;
+
+    scenarios.push_back({ "difficulty/idle",
+        [](ScreenManager& m, sf::RenderTarget& t) { m.setScreen(ScreenType::Difficulty, t); return true; },
+        [](ScreenManager&, int) {} });
+
+    scenarios.push_back({ "leaderboard/tabs",
+        [](ScreenManager& m, sf::RenderTarget& t) { m.setScreen(ScreenType::Leaderboard, t); return true; },
+        [](ScreenManager& m, int n) {
+            // Switch tab every 30 frames.
+            if (n % 30 == 0) m.getScreen()->handleMouseClick(220 + ((n / 30) % 3) * 130, 185);
+        } });
+
+    scenarios.push_back({ "game/idle", startGame, [](ScreenManager&, int) {} });
+
+    scenarios.push_back({ "game/selection", startGame,
+        [](ScreenManager& m, int n) { clickCell(*m.getScreen(), (n / 9) % 9, n % 9); } });
+
+    // Ask for a hint, apply it, then clear the filled cell again so the puzzle
+    // never completes (which would record a score).
+    scenarios.push_back({ "game/hints", startGame,
+        [](ScreenManager& m, int n) {
+            IScreen& screen = *m.getScreen();
+            ISudokuGame* game = m.getGame();
+            static int before[9][9];
+            switch (n % 3) {
+            case 0:
+                screen.handleKeyPress(sf::Keyboard::Key::H);
+                break;
+            case 1:
+                for (int r = 0; r < 9; ++r)
+                    for (int c = 0; c < 9; ++c) before[r][c] = game->getValue(r, c);
+                screen.handleMouseClick(BOARD_X + 445, BOARD_Y - 45);
+                break;
+            case 2:
+                for (int r = 0; r < 9; ++r)
+                    for (int c = 0; c < 9; ++c)
+                        if (game->getValue(r, c) != before[r][c]) {
+                            clickCell(screen, r, c);
+                            screen.handleKeyPress(sf::Keyboard::Key::Backspace);
+                        }
+                break;
+            }
+        } });
+
+    return scenarios;
+}
+
+void report(const std::string& name, std::vector<FrameSample>& samples) {
+    if (samples.empty()) return;
+
+    double total = 0;
+    std::size_t draws = 0, allocs = 0;
+    for (const auto& s : samples) {
+        total += s.micros;
+        draws += s.drawCalls;
+        allocs += s.allocations;
+    }
+
+    std::sort(samples.begin(), samples.end(),
+        [](const FrameSample& a, const FrameSample& b) { return a.micros < b.micros; });
+    auto percentile = [&](double p) {
+        return samples[std::min(samples.size() - 1, static_cast<std::size_t>(p * samples.size()))].micros;
+    };
+
+    double n = static_cast<double>(samples.size());
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(10) << total / n
+        << std::setw(10) << percentile(0.50)
+        << std::setw(10) << percentile(0.95)
+        << std::setw(10) << samples.back().micros
+        << std::setw(10) << draws / n
+        << std::setw(10) << allocs / n << "\n";
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 600;
+    std::string fontPath = argc > 2 ? argv[2] : "C:/Windows/Fonts/arial.ttf";
+
+    sf::Font font;
+    if (!font.openFromFile(fontPath)) {
+        std::cerr << "Font not found: " << fontPath << "\n";
+        return 1;
+    }
+
+    sf::RenderTexture target;
+    if (!target.resize(sf::Vector2u(WIDTH, HEIGHT))) {
+        std::cerr << "Could not create a " << WIDTH << "x" << HEIGHT << " render texture\n";
+        return 1;
+    }
+
+    std::cout << frames << " frames per scenario, " << WIDTH << "x" << HEIGHT << "\n";
+    std::cout << std::left << std::setw(20) << "scenario" << std::right
+        << std::setw(10) << "mean us" << std::setw(10) << "p50 us" << std::setw(10) << "p95 us"
+        << std::setw(10) << "max us" << std::setw(10) << "draws" << std::setw(10) << "allocs" << "\n";
+
+    ScreenManager manager(font);
+    manager.setUsername("bench");
+
+    for (const Scenario& scenario : buildScenarios()) {
+        if (!scenario.setup(manager, target)) {
+            std::cout << std::left << std::setw(20) << scenario.name << "setup failed\n";
+            continue;
+        }
+
+        std::vector<FrameSample> samples;
+        samples.reserve(frames);
+
+        // One untimed frame to fill the caches (static layers, glyph atlas).
+        manager.getScreen()->render(target);
+        target.display();
+
+        for (int n = 0; n < frames; ++n) {
+            scenario.input(manager, n);
+            // Run the game's queued observer callbacks where the UI's main loop does.
+            manager.deliverGameEvents();
+            manager.applyPending(target);
+            manager.deliverGameEvents();
+            IScreen* screen = manager.getScreen();
+
+            RenderStats::drawCalls = 0;
+            std::uint64_t allocsBefore = PerfStats::AllocationCount();
+            auto start = std::chrono::steady_clock::now();
+
+            screen->render(target);
+            target.display();
+
+            auto end = std::chrono::steady_clock::now();
+            samples.push_back({ std::chrono::duration<double, std::micro>(end - start).count(),
+                RenderStats::drawCalls, static_cast<std::size_t>(PerfStats::AllocationCount() - allocsBefore) });
+        }
+
+        report(scenario.name, samples);
+    }
+
+    return 0;
+}
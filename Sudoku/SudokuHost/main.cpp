@@ -0,0 +1,272 @@
+// Serves many concurrent games over a Unix domain socket.
+//
+// Each connection sends SessionProtocol request lines and receives one
+// response line per request; connections are served on their own threads and
+// share one SessionHost. With --load the host is exercised in-process instead:
+// it opens N sessions, plays moves on all of them from several threads and
+// reports the latency of each request type.
+//
+// Usage: SudokuHost [socket path] [--shards N] [--seeds N] [--load N [--threads T]]
+//   --seeds N  generate N seed puzzles per difficulty at startup, so new
+//              sessions are derived from the bank instead of generated
+
+#include "../SudokuLib/SessionHost.h"
+#include "../SudokuLib/SessionProtocol.h"
+#include "../SudokuLib/PuzzleBank.h"
+#include "../SudokuLib/SudokuGenerator.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <afunix.h>
+#pragma comment(lib, "Ws2_32.lib")
+using Socket = SOCKET;
+const Socket INVALID = INVALID_SOCKET;
+void closeSocket(Socket s) { closesocket(s); }
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+using Socket = int;
+const Socket INVALID = -1;
+void closeSocket(Socket s) { close(s); }
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void fillBank(PuzzleBank& bank, int seeds) {
+    SudokuGenerator generator;
+    for (Difficulty d : { Difficulty::EASY, Difficulty::MEDIUM, Difficulty::HARD }) {
+        for (int i = 0; i < seeds; ++i) {
+            SudokuBoard seed;
+            generator.Generate(seed, d);
+            bank.Add(d, seed);
+        }
+    }
+}
+
+// Longest request line accepted; valid requests are far shorter. A client
+// that sends a longer line is answered with an error and dropped.
+const std::size_t MAX_LINE = 256;
+
+void serveConnection(Socket client, SessionHost& host) {
+    SessionProtocol protocol(host);
+    std::string pending;
+    char buffer[4096];
+    bool tooLong = false;
+
+    while (!tooLong) {
+        int received = static_cast<int>(recv(client, buffer, sizeof(buffer), 0));
+        if (received <= 0) break;
+        pending.append(buffer, received);
+
+        std::string responses;
+        std::size_t start = 0, end;
+        while ((end = pending.find('\n', start)) != std::string::npos && end - start <= MAX_LINE) {
+            std::string line = pending.substr(start, end - start);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            responses += protocol.handle(line);
+            responses += '\n';
+            start = end + 1;
+        }
+        // The loop stopped at an overlong line, or the unterminated rest is already too long.
+        tooLong = end != std::string::npos || pending.size() - start > MAX_LINE;
+        pending.erase(0, start);
+        if (tooLong) responses += "ERR line too long\n";
+
+        for (std::size_t sent = 0; sent < responses.size();) {
+            int n = static_cast<int>(send(client, responses.data() + sent, static_cast<int>(responses.size() - sent), 0));
+            if (n <= 0) {
+                closeSocket(client);
+                return;
+            }
+            sent += n;
+        }
+    }
+    closeSocket(client);
+}
+
+int serve(const std::string& path, SessionHost& host) {
+    Socket server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server == INVALID) {
+        std::cerr << "Could not create socket\n";
+        return 1;
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Socket path too long: " << path << "\n";
+        return 1;
+    }
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    std::remove(path.c_str());
+
+    if (bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(server, 64) != 0) {
+        std::cerr << "Could not listen on " << path << "\n";
+        closeSocket(server);
+        return 1;
+    }
+    std::cout << "Listening on " << path << "\n";
+
+    for (;;) {
+        Socket client = accept(server, nullptr, nullptr);
+        if (client == INVALID) break;
+        std::thread(serveConnection, client, std::ref(host)).detach();
+    }
+
+    closeSocket(server);
+    return 0;
+}
+
+void reportLatency(const std::string& name, std::vector<float>& samples) {
+    if (samples.empty()) return;
+    double sum = 0.0;
+    for (float s : samples) sum += s;
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double p) {
+        return samples[std::min(samples.size() - 1, static_cast<std::size_t>(p * samples.size()))];
+    };
+    std::cout << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << samples.size()
+        << std::setw(10) << sum / samples.size()
+        << std::setw(10) << percentile(0.50)
+        << std::setw(10) << percentile(0.99)
+        << std::setw(10) << percentile(0.999)
+        << std::setw(12) << samples.back() << "\n";
+}
+
+// Opens sessions sessions, then makes moves on random sessions from all threads.
+void load(SessionHost& host, int sessions, int threads) {
+    struct Samples {
+        std::vector<float> create, set, get, hint;
+    };
+    std::vector<Samples> perThread(threads);
+    std::vector<SessionHost::SessionId> ids(sessions);
+    auto micros = [](Clock::time_point start) {
+        return std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+    };
+
+    auto run = [&](auto&& body) {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) workers.emplace_back(body, t);
+        for (auto& w : workers) w.join();
+    };
+
+    auto start = Clock::now();
+    std::atomic<int> next{ 0 };
+    run([&](int t) {
+        for (int i; (i = next.fetch_add(1)) < sessions;) {
+            auto begin = Clock::now();
+            ids[i] = host.createSession(static_cast<Difficulty>(i % 3));
+            perThread[t].create.push_back(micros(begin));
+        }
+    });
+    double createSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << host.sessionCount() << " sessions opened in " << std::fixed << std::setprecision(1)
+        << createSeconds * 1000.0 << " ms\n";
+
+    const int requestsPerThread = std::max(1000, sessions * 4 / threads);
+    start = Clock::now();
+    run([&](int t) {
+        std::mt19937 rng(t + 1);
+        std::uniform_int_distribution<int> pick(0, sessions - 1), cell(0, 80), digit(1, 9);
+        for (int i = 0; i < requestsPerThread; ++i) {
+            SessionHost::SessionId id = ids[pick(rng)];
+            int c = cell(rng);
+            auto begin = Clock::now();
+            if (i % 50 == 0) {
+                std::optional<Hint> hint;
+                host.hint(id, hint);
+                perThread[t].hint.push_back(micros(begin));
+            }
+            else if (i % 2 == 0) {
+                bool accepted;
+                host.setValue(id, c / 9, c % 9, digit(rng), accepted);
+                perThread[t].set.push_back(micros(begin));
+            }
+            else {
+                int value;
+                host.getValue(id, c / 9, c % 9, value);
+                perThread[t].get.push_back(micros(begin));
+            }
+        }
+    });
+    double requestSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << static_cast<long long>(requestsPerThread) * threads << " requests on " << threads << " threads in "
+        << requestSeconds * 1000.0 << " ms ("
+        << static_cast<long long>(requestsPerThread) * threads / requestSeconds << " requests/s)\n";
+
+    Samples all;
+    for (Samples& s : perThread) {
+        all.create.insert(all.create.end(), s.create.begin(), s.create.end());
+        all.set.insert(all.set.end(), s.set.begin(), s.set.end());
+        all.get.insert(all.get.end(), s.get.begin(), s.get.end());
+        all.hint.insert(all.hint.end(), s.hint.begin(), s.hint.end());
+    }
+    std::cout << std::left << std::setw(10) << "request" << std::right << std::setw(12) << "count"
+        << std::setw(10) << "mean us" << std::setw(10) << "p50 us" << std::setw(10) << "p99 us"
+        << std::setw(10) << "p99.9 us" << std::setw(12) << "max us" << "\n";
+    reportLatency("create", all.create);
+    reportLatency("setValue", all.set);
+    reportLatency("getValue", all.get);
+    reportLatency("hint", all.hint);
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    std::string path = "sudoku.sock";
+    int shards = 64;
+    int seeds = 0;
+    int loadSessions = 0;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--shards" && hasValue) shards = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--seeds" && hasValue) seeds = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--load" && hasValue) loadSessions = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && hasValue) threads = std::max(1, std::atoi(argv[++i]));
+        else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "Usage: SudokuHost [socket path] [--shards N] [--seeds N] [--load N [--threads T]]\n";
+            return 1;
+        }
+        else path = arg;
+    }
+
+    PuzzleBank bank;
+    if (seeds > 0) fillBank(bank, seeds);
+    SessionHost host(static_cast<std::size_t>(shards), seeds > 0 ? &bank : nullptr);
+
+    if (loadSessions > 0) {
+        load(host, loadSessions, threads);
+        return 0;
+    }
+
+#ifdef _WIN32
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) {
+        std::cerr << "Winsock initialization failed\n";
+        return 1;
+    }
+#endif
+    int result = serve(path, host);
+#ifdef _WIN32
+    WSACleanup();
+#endif
+    return result;
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "PerfStats.h"
+
+/**
+ * @brief Replacement global operator new/delete that count heap allocations.
+ *
+ * Every allocation made through operator new is reported to
+ * PerfStats::CountAllocation(). An executable that wants the counts defines
+ * ALLOCATION_COUNTER_IMPLEMENTATION in exactly one source file before
+ * including this header:
+ *
+ *     #define ALLOCATION_COUNTER_IMPLEMENTATION
+ *     #include "AllocationCounter.h"
+ *
+ * The library never defines it, so linking SudokuLib leaves the allocator alone.
+ */
+#ifdef ALLOCATION_COUNTER_IMPLEMENTATION
+#include <cstdlib>
+#include <new>
+
+void* operator new(std::size_t size) {
+    PerfStats::CountAllocation();
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    PerfStats::CountAllocation();
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+#endif
@@ -0,0 +1,44 @@
+#include "AsyncGameCreator.h"
+#include "SudokuGame.h"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    bool IsReady(const std::future<std::unique_ptr<SudokuGame>>& result) {
+        return result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+}
+
+AsyncGameCreator::~AsyncGameCreator() {
+    cancel();
+    // The futures' destructors wait for the (now stopping) threads.
+}
+
+void AsyncGameCreator::start(Difficulty difficulty) {
+    cancel();
+
+    current.stop = StopSource();
+    StopToken token = current.stop.GetToken();
+    current.result = std::async(std::launch::async, [difficulty, token]() -> std::unique_ptr<SudokuGame> {
+        auto game = std::make_unique<SudokuGame>(difficulty);
+        if (!game->startNewGame(token)) return nullptr;
+        return game;
+    });
+}
+
+void AsyncGameCreator::cancel() {
+    if (current.result.valid()) {
+        current.stop.RequestStop();
+        cancelled.push_back(std::move(current));
+        current = Creation();
+    }
+
+    // Forget threads that have already exited; the rest are still stopping.
+    cancelled.erase(std::remove_if(cancelled.begin(), cancelled.end(),
+        [](const Creation& c) { return IsReady(c.result); }), cancelled.end());
+}
+
+std::unique_ptr<SudokuGame> AsyncGameCreator::poll() {
+    if (!current.result.valid() || !IsReady(current.result)) return nullptr;
+    return current.result.get();
+}
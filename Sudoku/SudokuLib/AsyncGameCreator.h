@@ -0,0 +1,62 @@
+#pragma once
+#include "CancellationToken.h"
+#include "Difficulty.h"
+#include "SudokuGame.h"
+#include <future>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Creates games on a background thread and hands them over when finished.
+ *
+ * start() generates a complete game off the calling thread; nothing else sees
+ * the game until poll() returns it, so the UI never reads a board that is still
+ * being written. Starting a new creation or calling cancel() stops the previous
+ * one at its next cancellation point (between cell removals), so abandoned
+ * generations stop using CPU almost immediately.
+ *
+ * All methods must be called from the same (UI) thread.
+ */
+class AsyncGameCreator {
+public:
+    /**
+     * @brief Cancels any running creation and waits for the worker threads to exit.
+     */
+    ~AsyncGameCreator();
+
+    /**
+     * @brief Start creating a game, cancelling the one in progress.
+     *
+     * @param difficulty Difficulty of the new game.
+     */
+    void start(Difficulty difficulty);
+
+    /**
+     * @brief Cancel the creation in progress, if any.
+     */
+    void cancel();
+
+    /**
+     * @brief Whether a creation is in progress.
+     */
+    bool busy() const { return current.result.valid(); }
+
+    /**
+     * @brief Take the finished game, if the latest creation completed.
+     *
+     * Never waits.
+     *
+     * @return The started game, or nullptr while still generating (or when idle).
+     */
+    std::unique_ptr<SudokuGame> poll();
+
+private:
+    struct Creation {
+        StopSource stop;
+        std::future<std::unique_ptr<SudokuGame>> result;
+    };
+
+    Creation current;
+    // Cancelled creations whose threads have not exited yet.
+    std::vector<Creation> cancelled;
+};
@@ -0,0 +1,53 @@
+#include "AsyncHintService.h"
+
+AsyncHintService::AsyncHintService()
+    : worker(&AsyncHintService::run, this) {
+}
+
+AsyncHintService::~AsyncHintService() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();
+
+    if (pending) pending->promise.set_value({ std::nullopt, pending->board });
+}
+
+std::future<AsyncHintService::Result> AsyncHintService::request(
+    std::shared_ptr<const IHintProvider> provider, const ISudokuGame& game) {
+    Job job{ std::move(provider), std::make_shared<const BoardSnapshot>(game), {} };
+    std::future<Result> future = job.promise.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // The queued request is superseded; complete it without a hint.
+        if (pending) pending->promise.set_value({ std::nullopt, pending->board });
+        pending = std::move(job);
+    }
+    wake.notify_one();
+    return future;
+}
+
+void AsyncHintService::run() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || pending.has_value(); });
+            if (stopping) return;
+            job = std::move(*pending);
+            pending.reset();
+        }
+
+        Result result{ std::nullopt, job.board };
+        try {
+            if (job.provider) result.hint = job.provider->next(*job.board);
+            job.promise.set_value(std::move(result));
+        }
+        catch (...) {
+            job.promise.set_exception(std::current_exception());
+        }
+    }
+}
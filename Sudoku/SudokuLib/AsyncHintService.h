@@ -0,0 +1,66 @@
+#pragma once
+#include "BoardSnapshot.h"
+#include "Hint.h"
+#include "IHintProvider.h"
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+/**
+ * @brief Computes hints on a background thread.
+ *
+ * request() copies the board into a BoardSnapshot on the calling thread and
+ * returns immediately with a future; a single worker thread runs the provider
+ * on the snapshot. Only the latest request is kept: a request that is still
+ * queued when a newer one arrives is completed right away without a hint.
+ *
+ * The result carries the snapshot it was computed from, so the caller can
+ * discard it when the live board has changed in the meantime
+ * (BoardSnapshot::matches). The returned futures never block on destruction.
+ */
+class AsyncHintService {
+public:
+    /**
+     * @brief Outcome of a hint request.
+     */
+    struct Result {
+        /** @brief Hint produced by the provider, if any. */
+        std::optional<Hint> hint;
+
+        /** @brief Board the hint was computed for. */
+        std::shared_ptr<const BoardSnapshot> board;
+    };
+
+    AsyncHintService();
+    ~AsyncHintService();
+
+    AsyncHintService(const AsyncHintService&) = delete;
+    AsyncHintService& operator=(const AsyncHintService&) = delete;
+
+    /**
+     * @brief Queue a hint computation for the current state of game.
+     *
+     * @param provider Provider to run; shared so it outlives a game switch.
+     * @param game Game to snapshot; read on the calling thread only.
+     * @return Future that becomes ready when the hint has been computed.
+     */
+    std::future<Result> request(std::shared_ptr<const IHintProvider> provider, const ISudokuGame& game);
+
+private:
+    struct Job {
+        std::shared_ptr<const IHintProvider> provider;
+        std::shared_ptr<const BoardSnapshot> board;
+        std::promise<Result> promise;
+    };
+
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::optional<Job> pending;
+    bool stopping = false;
+    std::thread worker;
+};
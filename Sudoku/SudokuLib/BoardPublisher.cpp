@@ -0,0 +1,73 @@
+#include "BoardPublisher.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+BoardPublisher::BoardPublisher() {
+    for (auto& word : words) word.store(0, std::memory_order_relaxed);
+}
+
+void BoardPublisher::Publish(const ISudokuGame& game) {
+    std::uint8_t bytes[BYTES] = {};
+    const BoardView board = game.getBoardView();
+    for (int cell = 0; cell < 81; ++cell)
+        bytes[cell] = static_cast<std::uint8_t>(board.Value(cell) | (board.IsFixed(cell) ? FIXED_BIT : 0));
+    bytes[CELL_BYTES] = static_cast<std::uint8_t>(std::clamp(game.getRemainingAttempts(), 0, 255));
+    bytes[CELL_BYTES + 1] = static_cast<std::uint8_t>(game.getCurrentDifficulty());
+    bytes[CELL_BYTES + 2] = game.isComplete() ? 1 : 0;
+    const std::uint32_t elapsed = static_cast<std::uint32_t>(std::max(game.getElapsedTime(), 0));
+    std::memcpy(bytes + CELL_BYTES + 3, &elapsed, sizeof(elapsed));
+
+    std::uint64_t packed[WORDS];
+    std::memcpy(packed, bytes, BYTES);
+
+    // Take the odd "writing" state; a second writer waits here until the first is done.
+    std::uint64_t seq = sequence.load(std::memory_order_relaxed);
+    for (;;) {
+        if (seq % 2 == 0 && sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_relaxed))
+            break;
+        std::this_thread::yield();
+        seq = sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i < WORDS; ++i)
+        words[i].store(packed[i], std::memory_order_relaxed);
+
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+BoardSnapshot BoardPublisher::Read() const {
+    std::uint64_t packed[WORDS];
+    for (;;) {
+        const std::uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before % 2 != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (std::size_t i = 0; i < WORDS; ++i)
+            packed[i] = words[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before) break;
+    }
+
+    std::uint8_t bytes[BYTES];
+    std::memcpy(bytes, packed, BYTES);
+
+    BoardSnapshot snapshot;
+    for (int r = 0; r < 9; ++r) {
+        for (int c = 0; c < 9; ++c) {
+            const std::uint8_t cell = bytes[r * 9 + c];
+            snapshot.values[r][c] = cell & 0x0F;
+            snapshot.fixed[r][c] = (cell & FIXED_BIT) != 0;
+            snapshot.digitCells[cell & 0x0F].Set(r * 9 + c);
+        }
+    }
+    snapshot.remainingAttempts = bytes[CELL_BYTES];
+    snapshot.difficulty = static_cast<Difficulty>(bytes[CELL_BYTES + 1]);
+    snapshot.complete = bytes[CELL_BYTES + 2] != 0;
+    std::uint32_t elapsed;
+    std::memcpy(&elapsed, bytes + CELL_BYTES + 3, sizeof(elapsed));
+    snapshot.elapsedSeconds = static_cast<int>(elapsed);
+    return snapshot;
+}
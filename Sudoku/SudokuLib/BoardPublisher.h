@@ -0,0 +1,54 @@
+#pragma once
+#include "BoardSnapshot.h"
+#include "ISudokuGame.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Lock-free publication of a game's visible state to other threads.
+ *
+ * The thread that owns a game calls Publish() after every change; any number
+ * of reader threads (hint workers, autosave, a renderer) call Read() to get a
+ * consistent BoardSnapshot without touching the live game. The state is kept
+ * as a seqlock: an 88-byte packed board guarded by a sequence counter that is
+ * odd while a write is in progress. Readers retry when the counter moved
+ * under them, so they never see a half-written board, and writers never wait
+ * for readers. Concurrent writers are serialized against each other.
+ */
+class BoardPublisher {
+public:
+    BoardPublisher();
+
+    /**
+     * @brief Store the current state of game as the latest snapshot.
+     *
+     * @param game Game to copy; it must not be modified during the call.
+     */
+    void Publish(const ISudokuGame& game);
+
+    /**
+     * @brief Copy the latest published state. Never blocks a writer.
+     *
+     * Before the first Publish() the snapshot is an empty board.
+     * getElapsedTime() of the result is the time at publication.
+     */
+    BoardSnapshot Read() const;
+
+    /**
+     * @brief Number of completed publications.
+     */
+    std::uint64_t Version() const { return sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+    // One byte per cell (value | FIXED_BIT for givens), then attempts,
+    // difficulty, the complete flag and four bytes of elapsed seconds.
+    static constexpr std::uint8_t FIXED_BIT = 0x10;
+    static constexpr std::size_t CELL_BYTES = 81;
+    static constexpr std::size_t BYTES = 88;
+    static constexpr std::size_t WORDS = BYTES / sizeof(std::uint64_t);
+
+    std::atomic<std::uint64_t> sequence{ 0 };
+    std::array<std::atomic<std::uint64_t>, WORDS> words;
+};
@@ -0,0 +1,47 @@
+#include "BoardSnapshot.h"
+#include <algorithm>
+
+BoardSnapshot::BoardSnapshot(const ISudokuGame& game)
+    : remainingAttempts(game.getRemainingAttempts()),
+    difficulty(game.getCurrentDifficulty()),
+    elapsedSeconds(game.getElapsedTime()),
+    complete(game.isComplete()) {
+    const BoardView board = game.getBoardView();
+    std::copy(board.values, board.values + 81, &values[0][0]);
+    std::copy(board.fixed, board.fixed + 81, &fixed[0][0]);
+    std::copy(board.digits, board.digits + 10, digitCells);
+}
+
+bool BoardSnapshot::matches(const ISudokuGame& game) const {
+    const BoardView board = game.getBoardView();
+    return std::equal(board.values, board.values + 81, &values[0][0])
+        && std::equal(board.fixed, board.fixed + 81, &fixed[0][0]);
+}
+
+int BoardSnapshot::getValue(int row, int col) const {
+    if (!isValidPosition(row, col)) return -1;
+    return values[row][col];
+}
+
+CellState BoardSnapshot::getCellState(int row, int col) const {
+    if (!isValidPosition(row, col)) return CellState::EMPTY;
+    return getBoardView().State(row, col);
+}
+
+bool BoardSnapshot::isValidMove(int row, int col, int value) const {
+    // Without the solution only the Sudoku rules can be checked.
+    if (!isValidPosition(row, col) || value < 1 || value > 9) return false;
+    for (int x = 0; x < 9; ++x) {
+        if (x != col && values[row][x] == value) return false;
+        if (x != row && values[x][col] == value) return false;
+    }
+    int sr = row - row % 3, sc = col - col % 3;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            if ((sr + i != row || sc + j != col) && values[sr + i][sc + j] == value) return false;
+    return true;
+}
+
+bool BoardSnapshot::isComplete() const {
+    return complete;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "ISudokuGame.h"
+#include "CellState.h"
+#include "Difficulty.h"
+
+/**
+ * @brief Immutable copy of a game's visible state.
+ *
+ * A BoardSnapshot captures the values and cell states of an ISudokuGame at
+ * one point in time, so it can be analysed on another thread (for example by
+ * hint strategies) while the live game keeps changing. It implements the
+ * read-only part of ISudokuGame; all mutating calls are ignored.
+ */
+class BoardSnapshot : public ISudokuGame {
+public:
+    /**
+     * @brief Copy the current state of game.
+     *
+     * @param game Game to copy; it must not be modified during the call.
+     */
+    explicit BoardSnapshot(const ISudokuGame& game);
+
+    /**
+     * @brief Check whether game still shows the same board as this snapshot.
+     *
+     * @param game Game to compare against.
+     * @return true when every cell has the same value and state.
+     */
+    bool matches(const ISudokuGame& game) const;
+
+    int getValue(int row, int col) const override;
+    CellState getCellState(int row, int col) const override;
+    BoardView getBoardView() const override { return { &values[0][0], &fixed[0][0], digitCells }; }
+    bool isValidMove(int row, int col, int value) const override;
+    bool isComplete() const override;
+    int getRemainingAttempts() const override { return remainingAttempts; }
+    Difficulty getCurrentDifficulty() const override { return difficulty; }
+    int getElapsedTime() const override { return elapsedSeconds; }
+
+    // A snapshot never changes: these calls have no effect.
+    void startNewGame() override {}
+    void startNewGame(Difficulty) override {}
+    void generatePuzzle() override {}
+    bool setValue(int, int, int) override { return false; }
+    void reset() override {}
+    void attachObserver(IObserver*) override {}
+    void detachObserver(IObserver*) override {}
+    bool canUndo() const override { return false; }
+    bool canRedo() const override { return false; }
+    bool undo() override { return false; }
+    bool redo() override { return false; }
+
+private:
+    friend class BoardPublisher;
+
+    /** @brief Empty board; BoardPublisher fills in the fields. */
+    BoardSnapshot() = default;
+
+    int values[9][9];
+    bool fixed[9][9];
+    CellMask digitCells[10];
+    int remainingAttempts;
+    Difficulty difficulty;
+    int elapsedSeconds;
+    bool complete;
+
+    static bool isValidPosition(int row, int col) {
+        return row >= 0 && row < 9 && col >= 0 && col < 9;
+    }
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include "CellState.h"
+#include "CellMask.h"
+
+/**
+ * @brief Read-only view of a whole 9x9 board in two contiguous arrays.
+ *
+ * values holds the 81 cell values row by row (0 for empty), fixed marks
+ * the given cells and digits holds, for 0-9, the set of cells with that
+ * value. The view points into the game's own storage: it is
+ * obtained with a single call and reading a cell is a plain array access,
+ * with no virtual call and no bounds check. Indices must be in range. The
+ * view is valid until the game it came from changes or is destroyed.
+ */
+struct BoardView {
+    /** @brief 81 values, index = row * 9 + col. */
+    const int* values = nullptr;
+
+    /** @brief 81 flags, true for cells that are part of the puzzle. */
+    const bool* fixed = nullptr;
+
+    /** @brief 10 masks; digits[d] holds the cells with value d (d = 0: empty cells). */
+    const CellMask* digits = nullptr;
+
+    int Value(int cell) const { return values[cell]; }
+    int Value(int row, int col) const { return values[row * 9 + col]; }
+
+    bool IsFixed(int cell) const { return fixed[cell]; }
+    bool IsFixed(int row, int col) const { return fixed[row * 9 + col]; }
+
+    bool IsEmpty(int cell) const { return values[cell] == 0; }
+    bool IsEmpty(int row, int col) const { return values[row * 9 + col] == 0; }
+
+    /**
+     * @brief Cells holding digit (1-9), or the empty cells for 0.
+     */
+    const CellMask& Cells(int digit) const { return digits[digit]; }
+
+    /**
+     * @brief Same result as ISudokuGame::getCellState() for the cell.
+     */
+    CellState State(int row, int col) const {
+        const int cell = row * 9 + col;
+        if (values[cell] == 0) return CellState::EMPTY;
+        return fixed[cell] ? CellState::FIXED : CellState::FILLED;
+    }
+};
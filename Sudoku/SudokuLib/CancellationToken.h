@@ -0,0 +1,56 @@
+#pragma once
+#include <atomic>
+#include <memory>
+
+/**
+ * @brief Read side of a cancellation request (a minimal C++17 std::stop_token).
+ *
+ * Long-running work polls StopRequested() at safe points and returns early
+ * once it is set. A default-constructed token can never be stopped.
+ */
+class StopToken {
+public:
+    StopToken() = default;
+
+    /**
+     * @brief Whether the owning StopSource asked the work to stop.
+     */
+    bool StopRequested() const {
+        return state && state->load(std::memory_order_relaxed);
+    }
+
+private:
+    friend class StopSource;
+    explicit StopToken(std::shared_ptr<const std::atomic<bool>> state) : state(std::move(state)) {}
+
+    std::shared_ptr<const std::atomic<bool>> state;
+};
+
+/**
+ * @brief Write side of a cancellation request; hands out StopTokens.
+ *
+ * Tokens share the stop flag with their source and stay valid after the
+ * source is destroyed.
+ */
+class StopSource {
+public:
+    StopSource() : state(std::make_shared<std::atomic<bool>>(false)) {}
+
+    /**
+     * @brief Get a token observing this source.
+     */
+    StopToken GetToken() const { return StopToken(state); }
+
+    /**
+     * @brief Ask all work holding a token of this source to stop.
+     */
+    void RequestStop() { state->store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Whether RequestStop() was called.
+     */
+    bool StopRequested() const { return state->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> state;
+};
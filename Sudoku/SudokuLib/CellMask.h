@@ -0,0 +1,125 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Set of board cells as an 81-bit mask.
+ *
+ * Bit row * 9 + col stands for a cell; cells 0-63 live in low and 64-80 in
+ * high. Counting is a popcount and ForEach() visits only the set bits, so a
+ * query like "where is every 7" costs a few instructions instead of an
+ * 81-cell scan.
+ */
+struct CellMask {
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+
+    /** @brief Mask with all 81 cells set. */
+    static constexpr CellMask All() { return { ~std::uint64_t(0), (std::uint64_t(1) << 17) - 1 }; }
+
+    /** @brief Cells of row r (0-8). */
+    static const CellMask& Row(int r);
+
+    /** @brief Cells of column c (0-8). */
+    static const CellMask& Column(int c);
+
+    /** @brief Cells of the 3x3 box b (0-8, row-major). */
+    static const CellMask& Box(int b);
+
+    /** @brief Cells sharing a row, column or box with cell, including cell itself. */
+    static CellMask Peers(int cell) {
+        const int r = cell / 9, c = cell % 9;
+        return Row(r) | Column(c) | Box((r / 3) * 3 + c / 3);
+    }
+
+    void Set(int cell) { Word(cell) |= Bit(cell); }
+    void Reset(int cell) { Word(cell) &= ~Bit(cell); }
+    bool Test(int cell) const { return (Word(cell) & Bit(cell)) != 0; }
+
+    bool Any() const { return (low | high) != 0; }
+
+    /** @brief Cells in this set but not in other. */
+    CellMask Minus(const CellMask& other) const { return { low & ~other.low, high & ~other.high }; }
+
+    CellMask& operator|=(const CellMask& other) {
+        low |= other.low;
+        high |= other.high;
+        return *this;
+    }
+
+    /**
+     * @brief Number of cells in the set.
+     */
+    int Count() const { return PopCount(low) + PopCount(high); }
+
+    /**
+     * @brief Call f(cell) for every cell in the set, in ascending order.
+     */
+    template <typename F>
+    void ForEach(F&& f) const {
+        for (std::uint64_t bits = low; bits != 0; bits &= bits - 1) f(LowestBit(bits));
+        for (std::uint64_t bits = high; bits != 0; bits &= bits - 1) f(64 + LowestBit(bits));
+    }
+
+    friend bool operator==(const CellMask& a, const CellMask& b) { return a.low == b.low && a.high == b.high; }
+    friend bool operator!=(const CellMask& a, const CellMask& b) { return !(a == b); }
+    friend CellMask operator&(const CellMask& a, const CellMask& b) { return { a.low & b.low, a.high & b.high }; }
+    friend CellMask operator|(const CellMask& a, const CellMask& b) { return { a.low | b.low, a.high | b.high }; }
+
+private:
+    std::uint64_t& Word(int cell) { return cell < 64 ? low : high; }
+    const std::uint64_t& Word(int cell) const { return cell < 64 ? low : high; }
+    static std::uint64_t Bit(int cell) { return std::uint64_t(1) << (cell & 63); }
+
+    static int PopCount(std::uint64_t x) {
+        // Portable bit count; compilers turn it into POPCNT where available.
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<int>((x * 0x0101010101010101ull) >> 56);
+    }
+
+    static int LowestBit(std::uint64_t x) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return static_cast<int>(index);
+#elif defined(_MSC_VER)
+        unsigned long index;
+        if (_BitScanForward(&index, static_cast<unsigned long>(x))) return static_cast<int>(index);
+        _BitScanForward(&index, static_cast<unsigned long>(x >> 32));
+        return 32 + static_cast<int>(index);
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+};
+
+namespace CellMaskUnits {
+    /** @brief Masks of all rows, columns and boxes, built once. */
+    struct Table {
+        std::array<CellMask, 9> rows, columns, boxes;
+    };
+
+    inline const Table& Get() {
+        static const Table table = [] {
+            Table t;
+            for (int cell = 0; cell < 81; ++cell) {
+                const int r = cell / 9, c = cell % 9;
+                t.rows[r].Set(cell);
+                t.columns[c].Set(cell);
+                t.boxes[(r / 3) * 3 + c / 3].Set(cell);
+            }
+            return t;
+        }();
+        return table;
+    }
+}
+
+inline const CellMask& CellMask::Row(int r) { return CellMaskUnits::Get().rows[r]; }
+inline const CellMask& CellMask::Column(int c) { return CellMaskUnits::Get().columns[c]; }
+inline const CellMask& CellMask::Box(int b) { return CellMaskUnits::Get().boxes[b]; }
@@ -0,0 +1,42 @@
+#include "GameAutoSaver.h"
+#include "SudokuGame.h"
+
+GameAutoSaver::GameAutoSaver(SudokuGame& game, std::string path)
+    : game(game), path(std::move(path)) {
+    game.attachObserver(this);
+    save();
+}
+
+GameAutoSaver::~GameAutoSaver() {
+    // A queued win or loss may not have reached the saver yet.
+    if (!game.isComplete() && game.getRemainingAttempts() > 0) save();
+    game.detachObserver(this);
+}
+
+void GameAutoSaver::save() {
+    if (finished) return;
+    game.saveState(buffer);
+    // New games and resets notify twice (board, then attempts); write the record once.
+    if (buffer == written) return;
+    if (GameSave::Write(path, buffer)) written = buffer;
+}
+
+void GameAutoSaver::discard() {
+    finished = true;
+    written.fill(0);
+    GameSave::Remove(path);
+}
+
+void GameAutoSaver::onBoardChanged() { save(); }
+
+void GameAutoSaver::onGameComplete() { discard(); }
+
+void GameAutoSaver::onAttemptsChanged(int remaining) {
+    // A reset or a loaded save makes a finished game resumable again.
+    if (remaining <= 0) {
+        discard();
+        return;
+    }
+    finished = false;
+    save();
+}
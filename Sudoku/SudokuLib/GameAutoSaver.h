@@ -0,0 +1,57 @@
+#pragma once
+#include "GameSave.h"
+#include "IObserver.h"
+#include <string>
+
+class SudokuGame;
+
+/**
+ * @brief Keeps a save file in sync with a game.
+ *
+ * The saver observes a game and writes a GameSave record after every board or
+ * attempt change, so closing the application never loses more than the move
+ * being made. Once the game is won or lost the save is deleted, since there is
+ * nothing left to resume.
+ */
+class GameAutoSaver : public IObserver {
+public:
+    /**
+     * @brief Attach to game and save its current state.
+     *
+     * @param game Game to observe; must outlive the saver.
+     * @param path File the record is written to.
+     */
+    GameAutoSaver(SudokuGame& game, std::string path = GameSave::DEFAULT_FILE);
+
+    /**
+     * @brief Save once more and detach from the game. The save file is kept.
+     *
+     * The final save records the time played since the last move, so quitting
+     * or replacing an idle game does not lower its timer on resume.
+     */
+    ~GameAutoSaver() override;
+
+    GameAutoSaver(const GameAutoSaver&) = delete;
+    GameAutoSaver& operator=(const GameAutoSaver&) = delete;
+
+    void onBoardChanged() override;
+    void onGameComplete() override;
+    void onAttemptsChanged(int remaining) override;
+
+private:
+    /**
+     * @brief Encode the game and write it unless it matches the last record written.
+     */
+    void save();
+
+    /**
+     * @brief Delete the save file and stop saving until the game is reset.
+     */
+    void discard();
+
+    SudokuGame& game;
+    std::string path;
+    GameSave::Buffer buffer{};
+    GameSave::Buffer written{};
+    bool finished = false;
+};
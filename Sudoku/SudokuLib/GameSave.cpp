@@ -0,0 +1,47 @@
+#include "GameSave.h"
+#include <filesystem>
+#include <fstream>
+
+const std::string GameSave::DEFAULT_FILE = "savegame.bin";
+
+std::uint32_t GameSave::Checksum(const Buffer& buffer) {
+    std::uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < SIZE - 4; i++) {
+        hash ^= buffer[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool GameSave::Write(const std::string& path, const Buffer& buffer) {
+    namespace fs = std::filesystem;
+    const std::string tmpFile = path + ".tmp";
+    {
+        std::ofstream out(tmpFile, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+        out.write(reinterpret_cast<const char*>(buffer.data()), SIZE);
+        out.close();
+        if (!out) return false;
+    }
+
+    std::error_code ec;
+    fs::rename(tmpFile, path, ec);
+    return !ec;
+}
+
+bool GameSave::Read(const std::string& path, Buffer& buffer) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return false;
+    in.read(reinterpret_cast<char*>(buffer.data()), SIZE);
+    return in.gcount() == static_cast<std::streamsize>(SIZE) && in.peek() == std::ifstream::traits_type::eof();
+}
+
+bool GameSave::Exists(const std::string& path) {
+    std::error_code ec;
+    return std::filesystem::exists(path, ec);
+}
+
+void GameSave::Remove(const std::string& path) {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Fixed-size binary save record for an in-progress game.
+ *
+ * Layout (integers little endian):
+ *  - bytes 0-3: magic "SDKS"
+ *  - byte 4: format version
+ *  - byte 5: difficulty
+ *  - byte 6: remaining attempts
+ *  - bytes 7-10: elapsed seconds
+ *  - bytes 11-51: board values, two cells per byte
+ *  - bytes 52-92: solution values, two cells per byte
+ *  - bytes 93-103: fixed-cell mask, one bit per cell
+ *  - bytes 104-107: FNV-1a checksum of bytes 0-103
+ *
+ * SudokuGame::saveState() and SudokuGame::loadState() encode and decode the
+ * record; the functions here move it to and from disk.
+ */
+namespace GameSave {
+    /** @brief Size of a save record in bytes. */
+    constexpr std::size_t SIZE = 108;
+
+    /** @brief Current format version. */
+    constexpr std::uint8_t VERSION = 1;
+
+    using Buffer = std::array<std::uint8_t, SIZE>;
+
+    /** @brief Default save file, next to the leaderboard files. */
+    extern const std::string DEFAULT_FILE;
+
+    /**
+     * @brief Checksum stored in the last four bytes of a record.
+     */
+    std::uint32_t Checksum(const Buffer& buffer);
+
+    /**
+     * @brief Write a record, replacing the file atomically.
+     *
+     * The record goes to a temporary file that is renamed over path, so a
+     * crash mid-write leaves the previous save intact.
+     *
+     * @return false if the file could not be written.
+     */
+    bool Write(const std::string& path, const Buffer& buffer);
+
+    /**
+     * @brief Read a record.
+     *
+     * @return false if the file is missing or has the wrong size.
+     */
+    bool Read(const std::string& path, Buffer& buffer);
+
+    /**
+     * @brief Check whether a save file exists.
+     */
+    bool Exists(const std::string& path);
+
+    /**
+     * @brief Delete a save file, if any.
+     */
+    void Remove(const std::string& path);
+}
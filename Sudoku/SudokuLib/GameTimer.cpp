@@ -26,4 +26,9 @@ int GameTimer::GetElapsedSeconds() const {
     auto now = std::chrono::steady_clock::now();
     int current = static_cast<int>(std::chrono::duration_cast<std::chrono::seconds>(now - startTime).count());
     return accumulatedSeconds + current;
+}
+
+void GameTimer::SetElapsedSeconds(int seconds) {
+    accumulatedSeconds = seconds;
+    if (running) startTime = std::chrono::steady_clock::now();
 }
\ No newline at end of file
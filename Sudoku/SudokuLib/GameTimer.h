@@ -9,6 +9,8 @@ public:
     void Stop();
     void Reset();
     int GetElapsedSeconds() const;
+    // Replace the elapsed time, e.g. when resuming a saved game; keeps running if it was.
+    void SetElapsedSeconds(int seconds);
 
 private:
     std::chrono::steady_clock::time_point startTime;
@@ -0,0 +1,94 @@
+#include "GridGenerator.h"
+#include <array>
+
+namespace {
+    constexpr std::uint16_t AllDigits = 0x1FF;
+
+    struct CellIndex {
+        std::uint8_t row, col, box;
+    };
+
+    struct Tables {
+        CellIndex cells[81];
+        // bitCount[m] = number of set bits; nthBit[m][k] = index of the k-th set bit.
+        std::uint8_t bitCount[512];
+        std::uint8_t nthBit[512][9];
+    };
+
+    const Tables& GetTables() {
+        static const Tables tables = [] {
+            Tables t{};
+            for (int i = 0; i < 81; ++i) {
+                int r = i / 9, c = i % 9;
+                t.cells[i] = { static_cast<std::uint8_t>(r), static_cast<std::uint8_t>(c),
+                               static_cast<std::uint8_t>((r / 3) * 3 + c / 3) };
+            }
+            for (int m = 0; m < 512; ++m) {
+                int k = 0;
+                for (int b = 0; b < 9; ++b)
+                    if (m & (1 << b)) t.nthBit[m][k++] = static_cast<std::uint8_t>(b);
+                t.bitCount[m] = static_cast<std::uint8_t>(k);
+            }
+            return t;
+        }();
+        return tables;
+    }
+}
+
+GridGenerator::GridGenerator(std::mt19937& engine)
+    : engine(engine) {
+}
+
+std::uint32_t GridGenerator::NextRandom() {
+    // xorshift64*: far cheaper per pick than drawing from the mt19937.
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return static_cast<std::uint32_t>((state * 2685821657736338717ull) >> 32);
+}
+
+std::uint16_t GridGenerator::Allowed(int pos) const {
+    const CellIndex& cell = GetTables().cells[pos];
+    return static_cast<std::uint16_t>(AllDigits & ~(rowUsed[cell.row] | colUsed[cell.col] | boxUsed[cell.box]));
+}
+
+void GridGenerator::Generate(int grid[9][9]) {
+    const Tables& tables = GetTables();
+    int* cells = &grid[0][0];
+
+    state = (static_cast<std::uint64_t>(engine()) << 32) | engine();
+    if (state == 0) state = 1;
+    for (int i = 0; i < 9; ++i) rowUsed[i] = colUsed[i] = boxUsed[i] = 0;
+
+    int pos = 0;
+    untried[0] = AllDigits;
+    while (pos < 81) {
+        std::uint16_t& candidates = untried[pos];
+
+        if (candidates == 0) {
+            // Dead end: undo the previous cell and try its next candidate.
+            --pos;
+            const CellIndex& prev = tables.cells[pos];
+            std::uint16_t bit = static_cast<std::uint16_t>(1u << (cells[pos] - 1));
+            rowUsed[prev.row] &= ~bit;
+            colUsed[prev.col] &= ~bit;
+            boxUsed[prev.box] &= ~bit;
+            continue;
+        }
+
+        // Uniform pick among the untried candidates (multiply-shift range reduction).
+        int count = tables.bitCount[candidates];
+        int k = static_cast<int>((static_cast<std::uint64_t>(NextRandom()) * count) >> 32);
+        int digit = tables.nthBit[candidates][k];
+        std::uint16_t bit = static_cast<std::uint16_t>(1u << digit);
+        candidates &= ~bit;
+
+        const CellIndex& cell = tables.cells[pos];
+        cells[pos] = digit + 1;
+        rowUsed[cell.row] |= bit;
+        colUsed[cell.col] |= bit;
+        boxUsed[cell.box] |= bit;
+
+        if (++pos < 81) untried[pos] = Allowed(pos);
+    }
+}
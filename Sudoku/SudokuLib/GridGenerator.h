@@ -0,0 +1,66 @@
+#pragma once
+#include "Random.h"
+#include <cstdint>
+#include <random>
+
+/**
+ * @brief Fast generator of complete, valid 9x9 solution grids.
+ *
+ * Cells are filled in row-major order by an iterative backtracking search that
+ * keeps row/column/box usage as 9-bit masks and the untried candidates of every
+ * cell on an explicit 81-entry stack. Each step picks a uniformly random untried
+ * candidate, which gives the same distribution as shuffling the digits at every
+ * cell, without recursion or heap allocation.
+ *
+ * The mt19937 is only used to seed a small per-grid xorshift generator, which
+ * makes the picks cheap enough for hundreds of thousands of grids per second.
+ */
+class GridGenerator {
+public:
+    /**
+     * @brief Construct a generator drawing its choices from engine.
+     *
+     * @param engine Random engine; must outlive the generator.
+     */
+    explicit GridGenerator(std::mt19937& engine = Random::getEngine());
+
+    /**
+     * @brief Fill grid with a new random complete solution.
+     *
+     * @param grid Destination grid; every cell receives a digit 1-9.
+     */
+    void Generate(int grid[9][9]);
+
+private:
+    /**
+     * @brief Digits (bit d-1 for digit d) not yet used in the row, column and box of pos.
+     */
+    std::uint16_t Allowed(int pos) const;
+
+    /**
+     * @brief Next value of the per-grid xorshift generator.
+     */
+    std::uint32_t NextRandom();
+
+    /**
+     * @brief Random engine used to pick candidates.
+     */
+    std::mt19937& engine;
+
+    /**
+     * @brief xorshift64* state, reseeded from engine for every grid.
+     */
+    std::uint64_t state = 1;
+
+    /**
+     * @brief Digit masks already used in each row, column and box.
+     */
+    std::uint16_t rowUsed[9];
+    std::uint16_t colUsed[9];
+    std::uint16_t boxUsed[9];
+
+    /**
+     * @brief Candidates not tried yet at every depth of the search.
+     */
+    std::uint16_t untried[81];
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include <memory_resource>
 #include <vector>
 #include "ISudokuGame.h"
 #include "CellState.h"
@@ -10,11 +11,18 @@
  *
  * HintContext computes candidate lists for every empty cell once and
  * provides read-only access to the ISudokuGame required by strategies.
+ * Cell reads go through a BoardView taken once, so the scans in the
+ * context and in the strategies make no virtual calls.
+ * The lists are allocated from a caller-supplied memory resource, so
+ * HintManager can place a whole request in a scratch arena.
  */
 struct HintContext {
     /** @brief Reference to the game being analyzed (read-only). */
     const ISudokuGame& game;
 
+    /** @brief The game's board, read with plain array accesses. */
+    BoardView board;
+
     /**
      * @brief Precomputed candidate lists for each cell.
      *
@@ -22,7 +30,15 @@ struct HintContext {
      * contain a vector of possible candidates (1-9). Non-empty cells have an
      * empty candidate vector.
      */
-    std::vector<std::vector<int>> candidates;
+    std::pmr::vector<std::pmr::vector<int>> candidates;
+
+    /**
+     * @brief For each digit 1-9, the empty cells where it is a candidate (index 0 unused).
+     *
+     * The same information as candidates, arranged per digit so unit-wise
+     * questions ("where can 5 go in this row") are a mask intersection.
+     */
+    CellMask candidateCells[10];
 
     /**
      * @brief When true strategies are allowed to consult the stored solution
@@ -37,9 +53,11 @@ struct HintContext {
      *
      * @param g Reference to the ISudokuGame instance to analyze.
      * @param reveal If true strategies may read the stored solution where available.
+     * @param memory Resource the candidate lists are allocated from; must outlive the context.
      */
-    HintContext(const ISudokuGame& g, bool reveal = false)
-        : game(g), candidates(81), revealSolution(reveal) {
+    HintContext(const ISudokuGame& g, bool reveal = false,
+        std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : game(g), board(g.getBoardView()), candidates(81, memory), revealSolution(reveal) {
         computeAllCandidates();
     }
 
@@ -50,60 +68,32 @@ struct HintContext {
      * @param c Column index (0-8).
      * @return const reference to the vector<int> of candidates (possibly empty).
      */
-    const std::vector<int>& candidatesAt(int r, int c) const {
+    const std::pmr::vector<int>& candidatesAt(int r, int c) const {
         return candidates[r * 9 + c];
     }
 
 private:
-    /**
-     * @brief Helper to check whether a cell is currently empty.
-     *
-     * @param r Row index.
-     * @param c Column index.
-     * @return true if the cell state is CellState::EMPTY.
-     */
-    inline bool isCellEmpty(int r, int c) const {
-        return game.getCellState(r, c) == CellState::EMPTY;
-    }
-
-    /**
-     * @brief Check whether n is a safe candidate for cell (r,c) given current board.
-     *
-     * This performs row/column/3x3 block checks using game.getValue().
-     *
-     * @param r Row index.
-     * @param c Column index.
-     * @param n Candidate digit to test (1-9).
-     * @return true if n is not present in the row/column/block, false otherwise.
-     */
-    inline bool isSafeCandidate(int r, int c, int n) const {
-        for (int x = 0; x < 9; ++x) {
-            if (game.getValue(r, x) == n) return false;
-            if (game.getValue(x, c) == n) return false;
-        }
-        int sr = r - r % 3, sc = c - c % 3;
-        for (int i = 0; i < 3; ++i)
-            for (int j = 0; j < 3; ++j)
-                if (game.getValue(sr + i, sc + j) == n) return false;
-        return true;
-    }
-
     /**
      * @brief Compute candidate lists for all cells and store them in candidates.
      *
-     * This examines each empty cell and populates its candidates vector with
-     * digits 1-9 that pass isSafeCandidate(). Non-empty cells receive an empty list.
+     * A digit is a candidate in every empty cell that shares no unit with a
+     * cell already holding it, which the board's per-digit masks give
+     * directly. Non-empty cells receive an empty list.
      */
     void computeAllCandidates() {
-        for (int r = 0; r < 9; ++r) {
-            for (int c = 0; c < 9; ++c) {
-                auto& v = candidates[r * 9 + c];
-                v.clear();
-                if (!isCellEmpty(r, c)) continue;
-                for (int n = 1; n <= 9; ++n) {
-                    if (isSafeCandidate(r, c, n)) v.push_back(n);
-                }
-            }
+        const CellMask& empty = board.Cells(0);
+        empty.ForEach([this](int cell) {
+            // Full capacity up front: a growing vector would leave dead blocks in an arena.
+            candidates[cell].reserve(9);
+        });
+
+        for (int n = 1; n <= 9; ++n) {
+            CellMask seen;
+            board.Cells(n).ForEach([&seen](int cell) { seen |= CellMask::Peers(cell); });
+            const CellMask open = empty.Minus(seen);
+            candidateCells[n] = open;
+            // Digits are visited in ascending order, so every list ends up sorted.
+            open.ForEach([this, n](int cell) { candidates[cell].push_back(n); });
         }
     }
 };
\ No newline at end of file
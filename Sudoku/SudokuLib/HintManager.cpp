@@ -1,8 +1,11 @@
 #include "HintManager.h"
+#include "PerfStats.h"
 #include <random>
 #include <numeric>
 #include <stdexcept>
 #include <chrono>
+#include <cstddef>
+#include <memory_resource>
 
 // Thread-local RNG seeded once
 static std::mt19937& getRng() {
@@ -12,24 +15,43 @@ static std::mt19937& getRng() {
     return engine;
 }
 
+void HintManager::setStrategyEntries(std::vector<StrategyEntry> entries) {
+    strategies = std::move(entries);
+    strategyTimes.clear();
+    strategyTimes.reserve(strategies.size());
+    for (const auto& entry : strategies)
+        strategyTimes.push_back(&PerfStats::Channel("hint." + entry.name));
+}
+
 std::optional<Hint> HintManager::next(const ISudokuGame& game) const {
+    static PerfChannel& totalTime = PerfStats::Channel("hint");
+    PerfStats::ScopedTimer timing(totalTime);
+
+    // Everything below is allocated from this arena and released in one step
+    // when it goes out of scope. next() never recurses, so one buffer per
+    // thread is enough.
+    alignas(std::max_align_t) static thread_local std::byte buffer[ARENA_SIZE];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+
     // Build context (precompute candidates)
-    HintContext ctx(game, /*revealSolution=*/false);
+    HintContext ctx(game, /*revealSolution=*/false, &arena);
 
     // Collect all hints from strategies along with their weights
     struct Candidate {
         Hint hint;
         int weight;
-        std::string sourceName;
     };
-    std::vector<Candidate> candidates;
+    std::pmr::vector<Candidate> candidates(&arena);
+    candidates.reserve(strategies.size());
 
-    for (const auto& entry : strategies) {
+    for (std::size_t i = 0; i < strategies.size(); ++i) {
+        const auto& entry = strategies[i];
         if (!entry.strategy) continue;
         try {
+            PerfStats::ScopedTimer strategyTiming(*strategyTimes[i]);
             auto h = entry.strategy->getHint(ctx);
             if (h.has_value()) {
-                candidates.push_back({ std::move(h.value()), entry.weight, entry.name });
+                candidates.push_back({ std::move(h.value()), entry.weight });
             }
         }
         catch (...) {
@@ -46,17 +68,17 @@ std::optional<Hint> HintManager::next(const ISudokuGame& game) const {
     if (total <= 0) {
         // fallback: uniform selection
         std::uniform_int_distribution<size_t> dist(0, candidates.size() - 1);
-        return candidates[dist(getRng())].hint;
+        return std::move(candidates[dist(getRng())].hint);
     }
 
     // Weighted random selection
     std::uniform_int_distribution<long long> dist(1, total);
     long long pick = dist(getRng());
-    for (const auto& c : candidates) {
+    for (auto& c : candidates) {
         pick -= std::max(0, c.weight);
-        if (pick <= 0) return c.hint;
+        if (pick <= 0) return std::move(c.hint);
     }
 
     // Fallback in case of rounding issues
-    return candidates.front().hint;
+    return std::move(candidates.front().hint);
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "IHintProvider.h"
 #include "HintContext.h"
 
+class PerfChannel;
+
 // HintManager stores strategies together with metadata (weight, name).
 /**
  * @brief HintManager aggregates strategies and selects a hint to return.
@@ -14,6 +16,10 @@
  * HintManager builds a HintContext (precomputes candidates), queries all
  * configured strategies, and selects one of the returned hints using a
  * weighted random selection based on StrategyEntry::weight.
+ *
+ * The context and the list of collected hints live in a per-thread scratch
+ * arena that is dropped as a whole when next() returns, so a request does not
+ * go through the general-purpose heap except for the returned hint itself.
  */
 class HintManager : public IHintProvider {
 public:
@@ -39,9 +45,7 @@ public:
      * @param entries Vector of StrategyEntry structures. The entries are moved
      * into the manager.
      */
-    void setStrategyEntries(std::vector<StrategyEntry> entries) {
-        strategies = std::move(entries);
-    }
+    void setStrategyEntries(std::vector<StrategyEntry> entries);
 
     // next builds a HintContext (precomputes candidates once) and then asks strategies in any order,
     // collects all available hints and chooses one via weighted random selection.
@@ -58,6 +62,17 @@ public:
     std::optional<Hint> next(const ISudokuGame& game) const override;
 
 private:
+    /**
+     * @brief Size of the per-thread scratch buffer used by next().
+     *
+     * Comfortably holds a HintContext (about 6 KiB) and the collected hints;
+     * a request that needs more falls back to the heap for the excess.
+     */
+    static constexpr std::size_t ARENA_SIZE = 16 * 1024;
+
     /** @brief Stored strategy entries (ownership held by HintManager). */
     std::vector<StrategyEntry> strategies;
+
+    /** @brief Timing channel per entry in strategies, looked up once in setStrategyEntries. */
+    std::vector<PerfChannel*> strategyTimes;
 };
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "HintPrecomputer.h"
+#include <chrono>
+
+HintPrecomputer::HintPrecomputer(ISudokuGame& game, std::shared_ptr<const IHintProvider> provider, AsyncHintService& service)
+    : game(game), provider(std::move(provider)), service(service) {
+    game.attachObserver(this);
+    onBoardChanged();
+}
+
+HintPrecomputer::~HintPrecomputer() {
+    game.detachObserver(this);
+}
+
+void HintPrecomputer::onBoardChanged() {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Replacing the future abandons the previous request; the service drops it
+    // if it has not started yet.
+    pending = service.request(provider, game);
+}
+
+bool HintPrecomputer::current(std::optional<Hint>& hint) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pending.valid() && pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        try {
+            latest = pending.get();
+        }
+        catch (...) {
+            // Provider failure: report "no hint" for this board rather than waiting forever.
+            latest = AsyncHintService::Result{ std::nullopt, std::make_shared<const BoardSnapshot>(game) };
+        }
+    }
+
+    if (!latest || !latest->board->matches(game)) return false;
+    hint = latest->hint;
+    return true;
+}
+
+bool HintPrecomputer::ready() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pending.valid() && pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready) return true;
+    return latest && latest->board->matches(game);
+}
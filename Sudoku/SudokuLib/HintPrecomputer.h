@@ -0,0 +1,67 @@
+#pragma once
+#include "AsyncHintService.h"
+#include "IObserver.h"
+#include "ISudokuGame.h"
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+/**
+ * @brief Speculatively computes the next hint after every board change.
+ *
+ * The precomputer observes a game. Each onBoardChanged() queues a hint request
+ * for the new board on an AsyncHintService, so by the time the player asks for
+ * a hint it is usually already available from current(). A request that is
+ * still queued when the next move arrives is superseded and never runs; a
+ * result computed for an older board is never returned.
+ */
+class HintPrecomputer : public IObserver {
+public:
+    /**
+     * @brief Attach to game and start computing a hint for its current board.
+     *
+     * @param game Game to observe; must outlive the precomputer.
+     * @param provider Hint provider to run.
+     * @param service Worker used for the computations; must outlive the precomputer.
+     */
+    HintPrecomputer(ISudokuGame& game, std::shared_ptr<const IHintProvider> provider, AsyncHintService& service);
+
+    /**
+     * @brief Detach from the game. Pending computations finish in the background.
+     */
+    ~HintPrecomputer() override;
+
+    HintPrecomputer(const HintPrecomputer&) = delete;
+    HintPrecomputer& operator=(const HintPrecomputer&) = delete;
+
+    /**
+     * @brief Get the hint precomputed for the board the game shows now.
+     *
+     * Never waits for the worker.
+     *
+     * @param hint Receives the hint, or std::nullopt when no strategy found one.
+     * @return false while the computation for the current board is still running.
+     */
+    bool current(std::optional<Hint>& hint);
+
+    /**
+     * @brief Whether current() has something new to report, without collecting it.
+     *
+     * Never waits for the worker.
+     */
+    bool ready() const;
+
+    void onBoardChanged() override;
+    void onGameComplete() override {}
+    void onAttemptsChanged(int) override {}
+
+private:
+    ISudokuGame& game;
+    std::shared_ptr<const IHintProvider> provider;
+    AsyncHintService& service;
+
+    mutable std::mutex mutex;
+    std::future<AsyncHintService::Result> pending;
+    std::optional<AsyncHintService::Result> latest;
+};
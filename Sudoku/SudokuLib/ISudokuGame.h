@@ -2,6 +2,7 @@
 #include "Difficulty.h"
 #include "CellState.h"
 #include "IObserver.h"
+#include "BoardView.h"
 
 /**
  * @brief Abstract interface representing a Sudoku game.
@@ -73,6 +74,15 @@ public:
      */
     virtual CellState getCellState(int row, int col) const = 0;
 
+    /**
+     * @brief Get the whole board as contiguous arrays in one call.
+     *
+     * Prefer this over getValue()/getCellState() when reading many cells.
+     *
+     * @return View into the game's storage, valid until the game changes.
+     */
+    virtual BoardView getBoardView() const = 0;
+
     /**
      * @brief Check whether the current board is complete and valid.
      *
@@ -121,4 +131,32 @@ public:
      * @param observer Observer pointer to remove. Null pointers are ignored.
      */
     virtual void detachObserver(IObserver* observer) = 0;
+
+    /**
+     * @brief Check whether there is a move that undo() would revert.
+     */
+    virtual bool canUndo() const = 0;
+
+    /**
+     * @brief Check whether there is an undone move that redo() would apply again.
+     */
+    virtual bool canRedo() const = 0;
+
+    /**
+     * @brief Revert the latest move that changed the board.
+     *
+     * Rejected moves are stepped over; the attempts they consumed stay lost.
+     *
+     * @return true if a move was reverted, false if there was none or the game is over.
+     */
+    virtual bool undo() = 0;
+
+    /**
+     * @brief Apply the latest undone move again.
+     *
+     * Rejected moves are stepped over without consuming another attempt.
+     *
+     * @return true if a move was applied, false if there was none or the game is over.
+     */
+    virtual bool redo() = 0;
 };
\ No newline at end of file
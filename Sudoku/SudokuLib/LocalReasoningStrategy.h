@@ -12,20 +12,20 @@ public:
         // Find a cell with 2-3 candidates where at least one candidate is restricted in its row/col/box
         for (int r = 0; r < 9; ++r) {
             for (int c = 0; c < 9; ++c) {
-                if (ctx.game.getCellState(r, c) == CellState::EMPTY) {
+                if (ctx.board.IsEmpty(r, c)) {
                     const auto& cand = ctx.candidatesAt(r, c);
                     if (cand.size() >= 2 && cand.size() <= 3) {
                         // Check if any candidate appears in very few places in the unit (simple heuristic)
                         for (int v : cand) {
                             int rowCount = 0, colCount = 0, boxCount = 0;
                             for (int cc = 0; cc < 9; ++cc) {
-                                if (ctx.game.getCellState(r, cc) == CellState::EMPTY) {
+                                if (ctx.board.IsEmpty(r, cc)) {
                                     const auto& cands = ctx.candidatesAt(r, cc);
                                     if (std::find(cands.begin(), cands.end(), v) != cands.end()) ++rowCount;
                                 }
                             }
                             for (int rr = 0; rr < 9; ++rr) {
-                                if (ctx.game.getCellState(rr, c) == CellState::EMPTY) {
+                                if (ctx.board.IsEmpty(rr, c)) {
                                     const auto& cands = ctx.candidatesAt(rr, c);
                                     if (std::find(cands.begin(), cands.end(), v) != cands.end()) ++colCount;
                                 }
@@ -34,7 +34,7 @@ public:
                             for (int i = 0; i < 3; ++i)
                                 for (int j = 0; j < 3; ++j) {
                                     int rr = sr + i, cc = sc + j;
-                                    if (ctx.game.getCellState(rr, cc) == CellState::EMPTY) {
+                                    if (ctx.board.IsEmpty(rr, cc)) {
                                         const auto& cands = ctx.candidatesAt(rr, cc);
                                         if (std::find(cands.begin(), cands.end(), v) != cands.end()) ++boxCount;
                                     }
@@ -42,7 +42,7 @@ public:
 
                             if ((rowCount == 1) || (colCount == 1) || (boxCount == 1)) {
                                 Hint h; h.row = r; h.col = c; h.type = HintType::LocalReasoning;
-                                h.candidates = cand;
+                                h.candidates.assign(cand.begin(), cand.end());
                                 h.message = "Rationament local: celula (" + std::to_string(r) + "," + std::to_string(c) + ") are candidati restransi; verifica cifra " + std::to_string(v);
                                 return h;
                             }
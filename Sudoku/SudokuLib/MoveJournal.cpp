@@ -0,0 +1,52 @@
+#include "MoveJournal.h"
+
+// Record layout: bits 0-6 cell, 7-10 old value, 11-14 new value, 15 attempt consumed.
+std::uint16_t MoveJournal::Pack(const Move& move) {
+    return static_cast<std::uint16_t>(
+        (move.cell & 0x7F) |
+        ((move.oldValue & 0xF) << 7) |
+        ((move.newValue & 0xF) << 11) |
+        ((move.attemptConsumed ? 1 : 0) << 15));
+}
+
+MoveJournal::Move MoveJournal::Unpack(std::uint16_t record) {
+    Move move;
+    move.cell = record & 0x7F;
+    move.oldValue = (record >> 7) & 0xF;
+    move.newValue = (record >> 11) & 0xF;
+    move.attemptConsumed = (record >> 15) != 0;
+    return move;
+}
+
+MoveJournal::MoveJournal(std::size_t capacity)
+    : entries(capacity > 0 ? capacity : 1) {
+}
+
+void MoveJournal::Record(const Move& move) {
+    const std::size_t capacity = entries.size();
+    entries[(start + undoCount) % capacity] = Pack(move);
+    redoCount = 0;
+    if (undoCount < capacity) ++undoCount;
+    else start = (start + 1) % capacity;
+}
+
+MoveJournal::Move MoveJournal::Undo() {
+    --undoCount;
+    ++redoCount;
+    return Unpack(entries[(start + undoCount) % entries.size()]);
+}
+
+MoveJournal::Move MoveJournal::Redo() {
+    Move move = Unpack(entries[(start + undoCount) % entries.size()]);
+    ++undoCount;
+    --redoCount;
+    return move;
+}
+
+MoveJournal::Move MoveJournal::PeekUndo(std::size_t depth) const {
+    return Unpack(entries[(start + undoCount - 1 - depth) % entries.size()]);
+}
+
+MoveJournal::Move MoveJournal::PeekRedo(std::size_t depth) const {
+    return Unpack(entries[(start + undoCount + depth) % entries.size()]);
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Undo/redo history of moves, stored as packed 16-bit records in a ring.
+ *
+ * Each record holds the cell index (7 bits), the value before the move
+ * (4 bits), the value entered (4 bits) and whether the move consumed an
+ * attempt (1 bit). The ring is allocated once by the constructor: Record(),
+ * Undo() and Redo() are O(1) and never allocate. When the ring is full the
+ * oldest record is overwritten, so arbitrarily long sessions keep the last
+ * Capacity() moves undoable.
+ */
+class MoveJournal {
+public:
+    /** @brief Default number of records kept (128 KiB). */
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 16;
+
+    /**
+     * @brief One move, unpacked.
+     */
+    struct Move {
+        /** @brief Cell index, row * 9 + col. */
+        int cell = 0;
+        /** @brief Value of the cell before the move (0 for empty). */
+        int oldValue = 0;
+        /** @brief Value entered (0 for a clear). */
+        int newValue = 0;
+        /** @brief The move was rejected and cost an attempt; the board did not change. */
+        bool attemptConsumed = false;
+    };
+
+    /**
+     * @brief Create an empty journal keeping up to capacity records.
+     */
+    explicit MoveJournal(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Append a move and drop the redo history.
+     */
+    void Record(const Move& move);
+
+    /**
+     * @brief Whether there is a move to undo.
+     */
+    bool CanUndo() const { return undoCount > 0; }
+
+    /**
+     * @brief Whether there is an undone move to redo.
+     */
+    bool CanRedo() const { return redoCount > 0; }
+
+    /**
+     * @brief Step back over the latest move. Requires CanUndo().
+     *
+     * @return The move to revert.
+     */
+    Move Undo();
+
+    /**
+     * @brief Step forward over the latest undone move. Requires CanRedo().
+     *
+     * @return The move to apply again.
+     */
+    Move Redo();
+
+    /**
+     * @brief The move depth steps back from the latest one, without undoing it.
+     * Requires depth < UndoCount().
+     */
+    Move PeekUndo(std::size_t depth = 0) const;
+
+    /**
+     * @brief The undone move depth steps after the one Redo() would apply.
+     * Requires depth < RedoCount().
+     */
+    Move PeekRedo(std::size_t depth = 0) const;
+
+    /**
+     * @brief Forget all moves.
+     */
+    void Clear() { start = undoCount = redoCount = 0; }
+
+    /**
+     * @brief Number of moves that can be undone.
+     */
+    std::size_t UndoCount() const { return undoCount; }
+
+    /**
+     * @brief Number of moves that can be redone.
+     */
+    std::size_t RedoCount() const { return redoCount; }
+
+    /**
+     * @brief Maximum number of records kept.
+     */
+    std::size_t Capacity() const { return entries.size(); }
+
+    /**
+     * @brief Pack a move into its 16-bit record.
+     */
+    static std::uint16_t Pack(const Move& move);
+
+    /**
+     * @brief Unpack a 16-bit record.
+     */
+    static Move Unpack(std::uint16_t record);
+
+private:
+    std::vector<std::uint16_t> entries;
+    // Index of the oldest record.
+    std::size_t start = 0;
+    // Records [start, start + undoCount) are done, the next redoCount are undone.
+    std::size_t undoCount = 0;
+    std::size_t redoCount = 0;
+};
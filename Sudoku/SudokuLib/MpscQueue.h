@@ -0,0 +1,86 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Bounded lock-free queue for many producers and a single consumer.
+ *
+ * Each slot carries a sequence number that tells producers whether it is
+ * free and the consumer whether it is filled (Vyukov's bounded queue).
+ * Producers claim a slot with one compare-and-swap on the write position;
+ * the consumer needs no atomic read-modify-write at all. The ring is
+ * allocated once and neither operation allocates or blocks.
+ *
+ * TryPush() may be called from any thread; TryPop() from one thread at a time.
+ */
+template <typename T>
+class MpscQueue {
+public:
+    /**
+     * @param capacity Number of slots, rounded up to a power of two.
+     */
+    explicit MpscQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size *= 2;
+        mask = size - 1;
+        slots = std::make_unique<Slot[]>(size);
+        for (std::size_t i = 0; i < size; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * @brief Append a value.
+     *
+     * @return false when the queue is full; the value is not stored.
+     */
+    bool TryPush(const T& value) {
+        std::size_t pos = writePos.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots[pos & mask];
+            const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = writePos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value = value;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest value.
+     *
+     * @return false when the queue is empty or the oldest push is still in progress.
+     */
+    bool TryPop(T& out) {
+        Slot& slot = slots[readPos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != readPos + 1) return false;
+        out = slot.value;
+        slot.sequence.store(readPos + mask + 1, std::memory_order_release);
+        ++readPos;
+        return true;
+    }
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask = 0;
+    // Producers and the consumer work on different cache lines.
+    alignas(64) std::atomic<std::size_t> writePos{ 0 };
+    alignas(64) std::size_t readPos = 0;
+};
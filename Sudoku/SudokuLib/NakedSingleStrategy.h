@@ -7,14 +7,14 @@ public:
     std::optional<Hint> getHint(const HintContext& ctx) const override {
         for (int r = 0; r < 9; ++r) {
             for (int c = 0; c < 9; ++c) {
-                if (ctx.game.getCellState(r, c) == CellState::EMPTY) {
+                if (ctx.board.IsEmpty(r, c)) {
                     const auto& cand = ctx.candidatesAt(r, c);
                     if (cand.size() == 1) {
                         Hint h;
                         h.row = r; h.col = c;
                         h.value = cand[0];
                         h.type = HintType::NakedSingle;
-                        h.candidates = cand;
+                        h.candidates.assign(cand.begin(), cand.end());
                         h.message = "Naked Single: singurul candidat valid pe (" + std::to_string(r) + "," + std::to_string(c) + ") este " + std::to_string(h.value);
                         return h;
                     }
@@ -0,0 +1,116 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Recycling allocator for many long-lived objects of one type.
+ *
+ * Objects are placed in slots carved out of chunks of slotsPerChunk slots.
+ * Destroyed objects put their slot on a free list, and Create() reuses it
+ * before touching the heap, so a steady churn of objects allocates nothing
+ * once the pool has grown to the peak count. Chunks are only freed when the
+ * pool itself is destroyed.
+ *
+ * Create() and destruction through Ptr are thread-safe; the lock is held only
+ * to push or pop a slot, never while T is constructed or destroyed. Every
+ * object must be destroyed before the pool.
+ */
+template <typename T>
+class ObjectPool {
+public:
+    /**
+     * @brief Returns an object's slot to the pool it came from.
+     */
+    struct Deleter {
+        ObjectPool* pool = nullptr;
+        void operator()(T* object) const { pool->Destroy(object); }
+    };
+
+    /** @brief Owning pointer to a pooled object. */
+    using Ptr = std::unique_ptr<T, Deleter>;
+
+    explicit ObjectPool(std::size_t slotsPerChunk = 64)
+        : slotsPerChunk(slotsPerChunk > 0 ? slotsPerChunk : 1) {}
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /**
+     * @brief Construct an object in a free slot, growing the pool when none is left.
+     *
+     * If T's constructor throws the slot is returned and the exception propagates.
+     */
+    template <typename... Args>
+    Ptr Create(Args&&... args) {
+        Slot* slot = Acquire();
+        T* object;
+        try {
+            object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            Release(slot);
+            throw;
+        }
+        return Ptr(object, Deleter{ this });
+    }
+
+    /**
+     * @brief Number of slots allocated so far.
+     */
+    std::size_t Capacity() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return chunks.size() * slotsPerChunk;
+    }
+
+    /**
+     * @brief Number of live objects.
+     */
+    std::size_t InUse() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return inUse;
+    }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    Slot* Acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!freeList) {
+            chunks.push_back(std::make_unique<Slot[]>(slotsPerChunk));
+            Slot* chunk = chunks.back().get();
+            for (std::size_t i = 0; i < slotsPerChunk; ++i) {
+                chunk[i].next = freeList;
+                freeList = &chunk[i];
+            }
+        }
+        Slot* slot = freeList;
+        freeList = slot->next;
+        ++inUse;
+        return slot;
+    }
+
+    void Release(Slot* slot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        slot->next = freeList;
+        freeList = slot;
+        --inUse;
+    }
+
+    void Destroy(T* object) {
+        object->~T();
+        Release(reinterpret_cast<Slot*>(object));
+    }
+
+    const std::size_t slotsPerChunk;
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Slot[]>> chunks;
+    Slot* freeList = nullptr;
+    std::size_t inUse = 0;
+};
@@ -0,0 +1,124 @@
+#include "ObserverDispatcher.h"
+#include "PerfStats.h"
+#include <algorithm>
+
+// Time spent in observer callbacks, for notifications that have observers.
+static PerfChannel& DispatchTime() {
+    static PerfChannel& channel = PerfStats::Channel("observers");
+    return channel;
+}
+
+ObserverDispatcher::~ObserverDispatcher() {
+    delete observers.load(std::memory_order_acquire);
+}
+
+void ObserverDispatcher::Attach(IObserver* observer) {
+    if (!observer) return;
+    std::lock_guard<std::mutex> lock(writeMutex);
+    const ObserverList* current = observers.load(std::memory_order_acquire);
+    if (current && std::find(current->begin(), current->end(), observer) != current->end()) return;
+    auto updated = current ? std::make_unique<ObserverList>(*current) : std::make_unique<ObserverList>();
+    updated->push_back(observer);
+    Publish(std::move(updated));
+}
+
+void ObserverDispatcher::Detach(IObserver* observer) {
+    if (!observer) return;
+    std::lock_guard<std::mutex> lock(writeMutex);
+    const ObserverList* current = observers.load(std::memory_order_acquire);
+    if (!current || std::find(current->begin(), current->end(), observer) == current->end()) return;
+    auto updated = std::make_unique<ObserverList>(*current);
+    updated->erase(std::remove(updated->begin(), updated->end(), observer), updated->end());
+    if (updated->empty()) updated.reset();
+    Publish(std::move(updated));
+}
+
+void ObserverDispatcher::Publish(std::unique_ptr<const ObserverList> updated) {
+    const ObserverList* previous = observers.exchange(updated.release());
+    if (previous) retired.emplace_back(previous);
+    // A dispatch registers in readers before loading the list, so when none is
+    // registered now, any later one sees the new list and the retired ones are free.
+    if (readers.load() == 0) retired.clear();
+}
+
+void ObserverDispatcher::SetMode(Mode newMode) {
+    if (newMode == GetMode()) return;
+    if (newMode == Mode::Queued) {
+        if (!queue) queue = std::make_unique<MpscQueue<Event>>(QUEUE_CAPACITY);
+        mode.store(Mode::Queued, std::memory_order_release);
+    }
+    else {
+        Deliver();
+        mode.store(Mode::Immediate, std::memory_order_release);
+    }
+}
+
+void ObserverDispatcher::BoardChanged() {
+    Post({ Event::Type::BoardChanged, 0 });
+}
+
+void ObserverDispatcher::GameComplete() {
+    Post({ Event::Type::GameComplete, 0 });
+}
+
+void ObserverDispatcher::AttemptsChanged(int remaining) {
+    Post({ Event::Type::AttemptsChanged, remaining });
+}
+
+void ObserverDispatcher::Post(const Event& event) {
+    if (GetMode() == Mode::Immediate) {
+        Dispatch(event);
+        return;
+    }
+    if (queue->TryPush(event)) return;
+
+    switch (event.type) {
+    case Event::Type::BoardChanged: overflowBoard.store(true, std::memory_order_release); break;
+    case Event::Type::GameComplete: overflowComplete.store(true, std::memory_order_release); break;
+    case Event::Type::AttemptsChanged: overflowAttempts.store(event.remaining, std::memory_order_release); break;
+    }
+}
+
+std::size_t ObserverDispatcher::Deliver() {
+    if (!queue) return 0;
+
+    std::size_t delivered = 0;
+    Event event;
+    while (queue->TryPop(event)) {
+        Dispatch(event);
+        ++delivered;
+    }
+
+    if (overflowBoard.exchange(false, std::memory_order_acq_rel)) {
+        Dispatch({ Event::Type::BoardChanged, 0 });
+        ++delivered;
+    }
+    int remaining = overflowAttempts.exchange(NO_ATTEMPTS, std::memory_order_acq_rel);
+    if (remaining != NO_ATTEMPTS) {
+        Dispatch({ Event::Type::AttemptsChanged, remaining });
+        ++delivered;
+    }
+    if (overflowComplete.exchange(false, std::memory_order_acq_rel)) {
+        Dispatch({ Event::Type::GameComplete, 0 });
+        ++delivered;
+    }
+    return delivered;
+}
+
+void ObserverDispatcher::Dispatch(const Event& event) const {
+    if (!observers.load(std::memory_order_acquire)) return;
+
+    readers.fetch_add(1);
+    const ObserverList* current = observers.load();
+    if (current) {
+        PerfStats::ScopedTimer timing(DispatchTime());
+        for (IObserver* observer : *current) {
+            switch (event.type) {
+            case Event::Type::BoardChanged: observer->onBoardChanged(); break;
+            case Event::Type::GameComplete: observer->onGameComplete(); break;
+            case Event::Type::AttemptsChanged: observer->onAttemptsChanged(event.remaining); break;
+            }
+        }
+    }
+    readers.fetch_sub(1, std::memory_order_release);
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "IObserver.h"
+#include "MpscQueue.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Delivers game notifications to a set of observers.
+ *
+ * The observer set is copy-on-write: Attach() and Detach() build a new
+ * immutable list and publish its pointer atomically, while a dispatch keeps
+ * using the list it started with (RCU style). Observers may therefore attach
+ * or detach, also from inside a callback, without the dispatching thread
+ * taking a lock; an observer detached during a dispatch still receives that
+ * one event. Replaced lists are freed by a later Attach() or Detach() that
+ * finds no dispatch running, or with the dispatcher. With no observers a
+ * notification returns after one atomic load.
+ *
+ * In Immediate mode notifications are delivered synchronously on the
+ * notifying thread. In Queued mode they are pushed onto a lock-free queue and
+ * delivered by Deliver(), which the owner (for example the UI loop) calls on
+ * its own thread. Notifying never blocks: if the queue is full the events are
+ * folded into one board, attempts and completion notification each, which
+ * the next Deliver() reports after the queued ones.
+ */
+class ObserverDispatcher {
+public:
+    /**
+     * @brief How notifications reach the observers.
+     */
+    enum class Mode {
+        /** @brief Call observers on the notifying thread. */
+        Immediate,
+        /** @brief Queue notifications until Deliver() is called. */
+        Queued
+    };
+
+    /** @brief Number of notifications queued before they are folded together. */
+    static constexpr std::size_t QUEUE_CAPACITY = 256;
+
+    ObserverDispatcher() = default;
+    ~ObserverDispatcher();
+
+    ObserverDispatcher(const ObserverDispatcher&) = delete;
+    ObserverDispatcher& operator=(const ObserverDispatcher&) = delete;
+
+    /**
+     * @brief Add an observer; null and already attached observers are ignored.
+     */
+    void Attach(IObserver* observer);
+
+    /**
+     * @brief Remove an observer; unknown observers are ignored.
+     */
+    void Detach(IObserver* observer);
+
+    /**
+     * @brief Switch the delivery mode.
+     *
+     * Leaving Queued mode delivers the pending notifications first. Call from
+     * the thread that runs Deliver(), before other threads start notifying.
+     */
+    void SetMode(Mode newMode);
+
+    Mode GetMode() const { return mode.load(std::memory_order_acquire); }
+
+    void BoardChanged();
+    void GameComplete();
+    void AttemptsChanged(int remaining);
+
+    /**
+     * @brief Deliver queued notifications on the calling thread.
+     *
+     * Only one thread may deliver at a time. Does nothing in Immediate mode.
+     *
+     * @return Number of notifications delivered.
+     */
+    std::size_t Deliver();
+
+private:
+    struct Event {
+        enum class Type : std::uint8_t { BoardChanged, GameComplete, AttemptsChanged };
+        Type type = Type::BoardChanged;
+        int remaining = 0;
+    };
+
+    using ObserverList = std::vector<IObserver*>;
+
+    void Post(const Event& event);
+    void Dispatch(const Event& event) const;
+
+    /**
+     * @brief Publish updated as the observer list and retire the old one. Requires writeMutex.
+     */
+    void Publish(std::unique_ptr<const ObserverList> updated);
+
+    /** @brief Serializes Attach/Detach; dispatching never takes it. */
+    std::mutex writeMutex;
+
+    /** @brief Current observer list; null while there are none. Owned by the dispatcher. */
+    std::atomic<const ObserverList*> observers{ nullptr };
+
+    /** @brief Dispatches in progress; replaced lists are only freed while it is zero. */
+    mutable std::atomic<int> readers{ 0 };
+
+    /** @brief Replaced lists a running dispatch may still use. Guarded by writeMutex. */
+    std::vector<std::unique_ptr<const ObserverList>> retired;
+
+    std::atomic<Mode> mode{ Mode::Immediate };
+
+    /** @brief Created on the first switch to Queued mode. */
+    std::unique_ptr<MpscQueue<Event>> queue;
+
+    // Notifications that did not fit in the queue, folded together.
+    std::atomic<bool> overflowBoard{ false };
+    std::atomic<bool> overflowComplete{ false };
+    static constexpr int NO_ATTEMPTS = std::numeric_limits<int>::min();
+    std::atomic<int> overflowAttempts{ NO_ATTEMPTS };
+};
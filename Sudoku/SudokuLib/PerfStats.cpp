@@ -0,0 +1,66 @@
+#include "PerfStats.h"
+#include <map>
+#include <mutex>
+
+PerfChannel::PerfChannel() {
+    for (auto& s : samples) s.store(0.f, std::memory_order_relaxed);
+}
+
+void PerfChannel::Record(float value) {
+    std::uint64_t index = written.fetch_add(1, std::memory_order_acq_rel);
+    samples[index % CAPACITY].store(value, std::memory_order_relaxed);
+}
+
+float PerfChannel::Last() const {
+    std::uint64_t n = Count();
+    return n == 0 ? 0.f : samples[(n - 1) % CAPACITY].load(std::memory_order_relaxed);
+}
+
+std::size_t PerfChannel::Snapshot(std::array<float, CAPACITY>& out) const {
+    std::uint64_t n = Count();
+    std::size_t size = n < CAPACITY ? static_cast<std::size_t>(n) : CAPACITY;
+    std::uint64_t first = n - size;
+    for (std::size_t i = 0; i < size; ++i)
+        out[i] = samples[(first + i) % CAPACITY].load(std::memory_order_relaxed);
+    return size;
+}
+
+namespace {
+    struct Registry {
+        std::mutex mutex;
+        // std::map never moves its nodes, so references to channels stay valid.
+        std::map<std::string, PerfChannel> channels;
+    };
+
+    Registry& GetRegistry() {
+        static Registry registry;
+        return registry;
+    }
+
+    std::atomic<std::uint64_t> allocations{ 0 };
+}
+
+namespace PerfStats {
+    PerfChannel& Channel(const std::string& name) {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        return registry.channels[name];
+    }
+
+    std::vector<std::pair<std::string, const PerfChannel*>> Channels() {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        std::vector<std::pair<std::string, const PerfChannel*>> result;
+        result.reserve(registry.channels.size());
+        for (const auto& entry : registry.channels) result.emplace_back(entry.first, &entry.second);
+        return result;
+    }
+
+    void CountAllocation() {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::uint64_t AllocationCount() {
+        return allocations.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Fixed-size ring buffer of timing samples for one instrumented hot path.
+ *
+ * Record() is lock-free and allocation-free, so it can be called from the UI
+ * thread, the generator thread or observer callbacks, also concurrently.
+ * Readers copy a snapshot; a concurrent writer may replace samples while they
+ * are copied, which is fine for diagnostics.
+ */
+class PerfChannel {
+public:
+    /** @brief Number of most recent samples kept. */
+    static constexpr std::size_t CAPACITY = 128;
+
+    PerfChannel();
+
+    /**
+     * @brief Append a sample, overwriting the oldest one when the buffer is full.
+     *
+     * @param value Sample value; durations are recorded in microseconds.
+     */
+    void Record(float value);
+
+    /**
+     * @brief Total number of samples recorded since startup.
+     */
+    std::uint64_t Count() const { return written.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Most recent sample, or 0 when nothing was recorded yet.
+     */
+    float Last() const;
+
+    /**
+     * @brief Copy the buffered samples, oldest first.
+     *
+     * @param out Receives up to CAPACITY samples.
+     * @return Number of samples copied.
+     */
+    std::size_t Snapshot(std::array<float, CAPACITY>& out) const;
+
+private:
+    std::atomic<std::uint64_t> written{ 0 };
+    std::array<std::atomic<float>, CAPACITY> samples;
+};
+
+/**
+ * @brief Process-wide registry of named PerfChannels.
+ *
+ * Channel() returns a reference that stays valid for the lifetime of the
+ * process, so hot paths can look a channel up once and keep it:
+ *
+ *     static PerfChannel& channel = PerfStats::Channel("generate");
+ *     PerfStats::ScopedTimer timer(channel);
+ */
+namespace PerfStats {
+    /**
+     * @brief Get the channel with the given name, creating it on first use.
+     */
+    PerfChannel& Channel(const std::string& name);
+
+    /**
+     * @brief All channels created so far, sorted by name.
+     */
+    std::vector<std::pair<std::string, const PerfChannel*>> Channels();
+
+    /**
+     * @brief Count one heap allocation.
+     *
+     * Called by executables that replace the global operator new; the library
+     * itself does not hook the allocator.
+     */
+    void CountAllocation();
+
+    /**
+     * @brief Number of allocations counted so far (0 when the allocator is not hooked).
+     */
+    std::uint64_t AllocationCount();
+
+    /**
+     * @brief Records the lifetime of the object, in microseconds, into a channel.
+     */
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(PerfChannel& channel)
+            : channel(channel), start(std::chrono::steady_clock::now()) {}
+
+        ~ScopedTimer() {
+            channel.Record(std::chrono::duration<float, std::micro>(
+                std::chrono::steady_clock::now() - start).count());
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        PerfChannel& channel;
+        std::chrono::steady_clock::time_point start;
+    };
+}
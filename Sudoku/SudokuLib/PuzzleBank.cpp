@@ -0,0 +1,23 @@
+#include "PuzzleBank.h"
+#include "SudokuTransform.h"
+#include "Random.h"
+
+void PuzzleBank::Add(Difficulty difficulty, const SudokuBoard& seed) {
+    seeds[static_cast<int>(difficulty)].push_back(seed);
+}
+
+std::size_t PuzzleBank::Size(Difficulty difficulty) const {
+    return seeds[static_cast<int>(difficulty)].size();
+}
+
+bool PuzzleBank::Derive(Difficulty difficulty, SudokuBoard& out) const {
+    const auto& pool = seeds[static_cast<int>(difficulty)];
+    if (pool.empty()) return false;
+
+    auto& engine = Random::getEngine();
+    std::uniform_int_distribution<std::size_t> pick(0, pool.size() - 1);
+    const SudokuBoard& seed = pool[pick(engine)];
+
+    SudokuTransform::Random(engine).Apply(seed, out);
+    return true;
+}
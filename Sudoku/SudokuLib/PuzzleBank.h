@@ -0,0 +1,46 @@
+#pragma once
+#include "Difficulty.h"
+#include "SudokuBoard.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief A small bank of graded seed puzzles that serves derived games.
+ *
+ * Seeds are stored per Difficulty. Derive() picks a random seed and applies a
+ * random SudokuTransform, so every call returns a fresh-looking puzzle (with
+ * its solution) that keeps the seed's uniqueness and difficulty, without
+ * running the generator.
+ */
+class PuzzleBank {
+public:
+    /**
+     * @brief Add a seed puzzle for the given difficulty.
+     *
+     * The board must contain the puzzle (initial cells marked) and its solution.
+     *
+     * @param difficulty Difficulty grade of the seed.
+     * @param seed Puzzle to copy into the bank.
+     */
+    void Add(Difficulty difficulty, const SudokuBoard& seed);
+
+    /**
+     * @brief Number of seeds stored for the given difficulty.
+     */
+    std::size_t Size(Difficulty difficulty) const;
+
+    /**
+     * @brief Derive a new puzzle of the requested difficulty.
+     *
+     * @param difficulty Requested difficulty.
+     * @param out Board receiving the derived puzzle and solution.
+     * @return false when the bank has no seed for the difficulty (out is untouched).
+     */
+    bool Derive(Difficulty difficulty, SudokuBoard& out) const;
+
+private:
+    /**
+     * @brief Seeds indexed by static_cast<int>(Difficulty).
+     */
+    std::vector<SudokuBoard> seeds[3];
+};
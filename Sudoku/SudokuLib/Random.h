@@ -4,8 +4,9 @@
 #include <chrono>
 
 namespace Random {
+    // One engine per thread, so games generated in parallel do not share state.
     inline std::mt19937& getEngine() {
-        static std::mt19937 engine{ static_cast<std::mt19937::result_type>(
+        thread_local std::mt19937 engine{ static_cast<std::mt19937::result_type>(
             std::random_device{}() ^ (static_cast<std::mt19937::result_type>(
                 std::chrono::high_resolution_clock::now().time_since_epoch().count()))
         ) };
@@ -1,78 +1,302 @@
 #include "ScoreManager.h"
+#include "PerfStats.h"
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <map>
 #include <algorithm>
+#include <filesystem>
+#include <future>
+#include <mutex>
 
 const std::string ScoreManager::LEADERBOARD_FILE = "leaderboard.txt";
+const std::string ScoreManager::LOG_FILE = "leaderboard.log";
+const std::string ScoreManager::COMPACTING_FILE = "leaderboard.log.compacting";
 
-void ScoreManager::updateOrAddScore(const std::string& username, const std::string& difficulty, int timeInSeconds) {
-    std::map<std::pair<std::string, std::string>, int> scoreMap;
+namespace {
+    using ScoreList = std::vector<std::pair<std::string, int>>;
+    using BestTimes = std::map<std::pair<std::string, std::string>, int>;
+
+    /**
+     * @brief Modification time and size of one file, used to detect outside changes.
+     */
+    struct FileVersion {
+        bool exists = false;
+        std::filesystem::file_time_type modified{};
+        std::uintmax_t size = 0;
+
+        bool operator==(const FileVersion& other) const {
+            return exists == other.exists && modified == other.modified && size == other.size;
+        }
+    };
+
+    /**
+     * @brief Top list and rank counts for one difficulty.
+     */
+    struct DifficultyIndex {
+        // Best scores sorted by (time, username), at most TOP_K entries.
+        ScoreList top;
+
+        // Fenwick tree over seconds: how many users have each best time.
+        std::vector<int> counts;
+
+        int users = 0;
+
+        void add(int time, int delta, int maxTime) {
+            if (counts.empty()) counts.assign(maxTime + 2, 0);
+            for (int i = std::clamp(time, 0, maxTime) + 1; i < static_cast<int>(counts.size()); i += i & -i)
+                counts[i] += delta;
+        }
+
+        // Number of users whose best time is strictly below time.
+        int countBelow(int time, int maxTime) const {
+            int total = 0;
+            for (int i = std::clamp(time, 0, maxTime); i > 0 && !counts.empty(); i -= i & -i)
+                total += counts[i];
+            return total;
+        }
+    };
 
-    std::ifstream inFile(LEADERBOARD_FILE);
-    if (inFile.is_open()) {
+    /**
+     * @brief In-memory copy of the leaderboard files.
+     */
+    struct LeaderboardCache {
+        bool loaded = false;
+        FileVersion snapshot, compacting, log;
+
+        // Best time per (username, difficulty) across snapshot and log.
+        BestTimes best;
+
+        // Top list and rank index per difficulty.
+        std::map<std::string, DifficultyIndex> byDifficulty;
+
+        // Records appended to the log since the last compaction.
+        int logRecords = 0;
+    };
+
+    LeaderboardCache& cache() {
+        static LeaderboardCache instance;
+        return instance;
+    }
+
+    // Serializes appends to the log with the compaction renaming it away.
+    std::mutex& logMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    std::future<void>& compaction() {
+        static std::future<void> pending;
+        return pending;
+    }
+
+    FileVersion versionOf(const std::string& path) {
+        FileVersion v;
+        std::error_code ec;
+        v.exists = std::filesystem::exists(path, ec);
+        if (v.exists) {
+            v.modified = std::filesystem::last_write_time(path, ec);
+            v.size = std::filesystem::file_size(path, ec);
+        }
+        return v;
+    }
+
+    // Merge every "user,difficulty,time" record of a file into best; returns the record count.
+    // Lines that do not parse or have a negative time are skipped.
+    int loadRecords(const std::string& path, BestTimes& best) {
+        std::ifstream inFile(path);
+        if (!inFile.is_open()) return 0;
+
+        int records = 0;
         std::string line;
         while (std::getline(inFile, line)) {
             std::istringstream ss(line);
-            std::string user, diff, timeStr;
+            std::string user, diff;
+            int time;
             if (std::getline(ss, user, ',') &&
                 std::getline(ss, diff, ',') &&
-                std::getline(ss, timeStr)) {
-                int time = std::stoi(timeStr);
+                (ss >> time) && time >= 0) {
                 auto key = std::make_pair(user, diff);
-
-                if (scoreMap.find(key) == scoreMap.end() || time < scoreMap[key]) {
-                    scoreMap[key] = time;
+                auto it = best.find(key);
+                if (it == best.end() || time < it->second) {
+                    best[key] = time;
                 }
+                ++records;
             }
         }
-        inFile.close();
+        return records;
     }
 
-    auto key = std::make_pair(username, difficulty);
-    if (scoreMap.find(key) == scoreMap.end() || timeInSeconds < scoreMap[key]) {
-        scoreMap[key] = timeInSeconds;
+    bool rankedBefore(const std::pair<std::string, int>& a, const std::pair<std::string, int>& b) {
+        return a.second != b.second ? a.second < b.second : a.first < b.first;
     }
+}
 
-    std::ofstream outFile(LEADERBOARD_FILE);
-    if (outFile.is_open()) {
-        for (const auto& entry : scoreMap) {
-            outFile << entry.first.first << ","
-                << entry.first.second << ","
-                << entry.second << "\n";
+void ScoreManager::rememberFileVersion() {
+    LeaderboardCache& c = cache();
+    c.snapshot = versionOf(LEADERBOARD_FILE);
+    c.compacting = versionOf(COMPACTING_FILE);
+    c.log = versionOf(LOG_FILE);
+}
+
+void ScoreManager::refresh() {
+    LeaderboardCache& c = cache();
+
+    if (c.loaded &&
+        versionOf(LEADERBOARD_FILE) == c.snapshot &&
+        versionOf(COMPACTING_FILE) == c.compacting &&
+        versionOf(LOG_FILE) == c.log) {
+        return;
+    }
+
+    static PerfChannel& loadTime = PerfStats::Channel("leaderboard.load");
+    PerfStats::ScopedTimer timing(loadTime);
+
+    c.best.clear();
+    c.byDifficulty.clear();
+
+    {
+        // Hold the log lock so a compaction cannot move records between files mid-load.
+        std::lock_guard<std::mutex> lock(logMutex());
+        loadRecords(LEADERBOARD_FILE, c.best);
+        c.logRecords = loadRecords(COMPACTING_FILE, c.best);
+        c.logRecords += loadRecords(LOG_FILE, c.best);
+        rememberFileVersion();
+    }
+
+    for (const auto& entry : c.best) {
+        indexScore(entry.first.first, entry.first.second, entry.second, -1);
+    }
+    c.loaded = true;
+}
+
+void ScoreManager::updateOrAddScore(const std::string& username, const std::string& difficulty, int timeInSeconds) {
+    if (timeInSeconds < 0) return;
+    refresh();
+    LeaderboardCache& c = cache();
+
+    auto key = std::make_pair(username, difficulty);
+    auto it = c.best.find(key);
+    if (it != c.best.end() && it->second <= timeInSeconds) return;
+    indexScore(username, difficulty, timeInSeconds, it != c.best.end() ? it->second : -1);
+    c.best[key] = timeInSeconds;
+
+    {
+        std::lock_guard<std::mutex> lock(logMutex());
+        std::ofstream outFile(LOG_FILE, std::ios::app);
+        if (outFile.is_open()) {
+            outFile << username << "," << difficulty << "," << timeInSeconds << "\n";
+            outFile.close();
         }
-        outFile.close();
+
+        // Our own write must not trigger a reload.
+        rememberFileVersion();
+    }
+
+    if (++c.logRecords >= COMPACT_THRESHOLD) {
+        scheduleCompaction();
     }
 }
 
-std::vector<std::pair<std::string, int>> ScoreManager::getScoresForDifficulty(const std::string& difficulty) {
-    std::vector<std::pair<std::string, int>> scores;
+void ScoreManager::indexScore(const std::string& username, const std::string& difficulty, int timeInSeconds, int previousTime) {
+    DifficultyIndex& index = cache().byDifficulty[difficulty];
 
-    std::ifstream file(LEADERBOARD_FILE);
-    if (file.is_open()) {
-        std::string line;
-        while (std::getline(file, line)) {
-            std::istringstream ss(line);
-            std::string user, diff, timeStr;
-            if (std::getline(ss, user, ',') &&
-                std::getline(ss, diff, ',') &&
-                std::getline(ss, timeStr)) {
-                if (diff == difficulty) {
-                    int time = std::stoi(timeStr);
-                    scores.push_back(std::make_pair(user, time));
-                }
-            }
+    if (previousTime >= 0) {
+        index.add(previousTime, -1, MAX_RANKED_SECONDS);
+    }
+    else {
+        ++index.users;
+    }
+    index.add(timeInSeconds, 1, MAX_RANKED_SECONDS);
+
+    // Times only improve, so a user already in the list moves up and nobody
+    // outside it can be pushed back in.
+    ScoreList& top = index.top;
+    auto old = std::find_if(top.begin(), top.end(),
+        [&](const auto& entry) { return entry.first == username; });
+    if (old != top.end()) top.erase(old);
+
+    std::pair<std::string, int> entry(username, timeInSeconds);
+    if (static_cast<int>(top.size()) < TOP_K || rankedBefore(entry, top.back())) {
+        top.insert(std::upper_bound(top.begin(), top.end(), entry, rankedBefore), entry);
+        if (static_cast<int>(top.size()) > TOP_K) top.pop_back();
+    }
+}
+
+const std::vector<std::pair<std::string, int>>& ScoreManager::getTopScores(const std::string& difficulty) {
+    refresh();
+    // operator[] gives an empty list for difficulties without scores.
+    return cache().byDifficulty[difficulty].top;
+}
+
+int ScoreManager::getRank(const std::string& username, const std::string& difficulty) {
+    refresh();
+    LeaderboardCache& c = cache();
+
+    auto it = c.best.find(std::make_pair(username, difficulty));
+    if (it == c.best.end()) return 0;
+    return c.byDifficulty[difficulty].countBelow(it->second, MAX_RANKED_SECONDS) + 1;
+}
+
+int ScoreManager::getScoreCount(const std::string& difficulty) {
+    refresh();
+    return cache().byDifficulty[difficulty].users;
+}
+
+void ScoreManager::scheduleCompaction() {
+    auto& pending = compaction();
+    if (pending.valid() && pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return;
+
+    cache().logRecords = 0;
+    pending = std::async(std::launch::async, &ScoreManager::runCompaction);
+}
+
+void ScoreManager::compact() {
+    auto& pending = compaction();
+    if (pending.valid()) pending.wait();
+
+    cache().logRecords = 0;
+    runCompaction();
+}
+
+void ScoreManager::runCompaction() {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+
+    {
+        // Move the live log aside; new records go to a fresh log from now on. A
+        // .compacting file left by an interrupted compaction is folded first.
+        std::lock_guard<std::mutex> lock(logMutex());
+        if (!fs::exists(COMPACTING_FILE, ec)) {
+            if (!fs::exists(LOG_FILE, ec)) return;
+            fs::rename(LOG_FILE, COMPACTING_FILE, ec);
+            if (ec) return;
         }
-        file.close();
     }
 
-    std::sort(scores.begin(), scores.end(),
-        [](const auto& a, const auto& b) {
-            return a.second < b.second;
-        });
+    BestTimes best;
+    loadRecords(LEADERBOARD_FILE, best);
+    loadRecords(COMPACTING_FILE, best);
+
+    const std::string tmpFile = LEADERBOARD_FILE + ".tmp";
+    {
+        std::ofstream outFile(tmpFile, std::ios::trunc);
+        if (!outFile.is_open()) return;
+        for (const auto& entry : best) {
+            outFile << entry.first.first << ","
+                << entry.first.second << ","
+                << entry.second << "\n";
+        }
+        outFile.close();
+        if (!outFile) return;
+    }
 
-    return scores;
+    // Readers see either the old snapshot plus .compacting or the new snapshot,
+    // never a partial file.
+    std::lock_guard<std::mutex> lock(logMutex());
+    fs::rename(tmpFile, LEADERBOARD_FILE, ec);
+    if (ec) return;
+    fs::remove(COMPACTING_FILE, ec);
 }
 
 std::string ScoreManager::formatTime(int seconds) {
@@ -82,4 +306,4 @@ std::string ScoreManager::formatTime(int seconds) {
     oss << std::setfill('0') << std::setw(2) << mins << ":"
         << std::setfill('0') << std::setw(2) << secs;
     return oss.str();
-}
\ No newline at end of file
+}
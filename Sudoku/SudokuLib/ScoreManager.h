@@ -3,12 +3,111 @@
 #include <vector>
 #include <utility>
 
+/**
+ * @brief Persistent best-time leaderboard.
+ *
+ * Storage is split in two files: leaderboard.txt holds a compacted snapshot with
+ * the best time per user and difficulty, and leaderboard.log receives one
+ * appended record per new best time. Once the log grows past a threshold it is
+ * folded into the snapshot on a background thread; the new snapshot is written
+ * to a temporary file and renamed over the old one, so readers never see a torn
+ * file.
+ *
+ * Scores are kept in an in-memory index that is reloaded only when one of the
+ * files changes on disk (for example when another instance writes them), so
+ * reads are cheap enough to run every frame.
+ */
 class ScoreManager {
 public:
+    /**
+     * @brief Record a time, keeping only the best time per user and difficulty.
+     *
+     * Updates the in-memory index and appends a single record to the log.
+     * Negative times are ignored.
+     */
     static void updateOrAddScore(const std::string& username, const std::string& difficulty, int timeInSeconds);
-    static std::vector<std::pair<std::string, int>> getScoresForDifficulty(const std::string& difficulty);
+
+    /**
+     * @brief Best TOP_K scores for a difficulty, sorted by ascending time.
+     *
+     * The list is maintained on every insert, so the query is O(TOP_K) no matter
+     * how many scores are stored. The returned reference points into the cache and
+     * stays valid until the next call into ScoreManager.
+     */
+    static const std::vector<std::pair<std::string, int>>& getTopScores(const std::string& difficulty);
+
+    /**
+     * @brief Position of a user's best time among all scores for a difficulty.
+     *
+     * Users with equal times share a rank. Times of MAX_RANKED_SECONDS and above
+     * are ranked together.
+     *
+     * @return 1-based rank, or 0 if the user has no score for the difficulty.
+     */
+    static int getRank(const std::string& username, const std::string& difficulty);
+
+    /**
+     * @brief Number of users with a score for a difficulty.
+     */
+    static int getScoreCount(const std::string& difficulty);
+
+    /**
+     * @brief Fold the log into the snapshot now, blocking until it is done.
+     *
+     * Waits for a background compaction that is already running first.
+     */
+    static void compact();
+
     static std::string formatTime(int seconds);
 
 private:
     static const std::string LEADERBOARD_FILE;
-};
\ No newline at end of file
+    static const std::string LOG_FILE;
+
+    /**
+     * @brief Log file being folded into the snapshot by a compaction.
+     */
+    static const std::string COMPACTING_FILE;
+
+    /**
+     * @brief Number of appended records after which a background compaction starts.
+     */
+    static const int COMPACT_THRESHOLD = 512;
+
+    /**
+     * @brief Number of scores kept in the per-difficulty top list.
+     */
+    static const int TOP_K = 10;
+
+    /**
+     * @brief Largest time (99:59) distinguished by getRank.
+     */
+    static const int MAX_RANKED_SECONDS = 99 * 60 + 59;
+
+    /**
+     * @brief Reload the index if any leaderboard file changed since it was last read or written.
+     */
+    static void refresh();
+
+    /**
+     * @brief Apply a new best time for a user to the per-difficulty index.
+     *
+     * @param previousTime The user's earlier best time, or -1 if there was none.
+     */
+    static void indexScore(const std::string& username, const std::string& difficulty, int timeInSeconds, int previousTime);
+
+    /**
+     * @brief Remember the files' current modification times and sizes as the loaded version.
+     */
+    static void rememberFileVersion();
+
+    /**
+     * @brief Start a compaction on a background thread unless one is already running.
+     */
+    static void scheduleCompaction();
+
+    /**
+     * @brief Merge snapshot and log into a new snapshot. Runs on the compaction thread.
+     */
+    static void runCompaction();
+};
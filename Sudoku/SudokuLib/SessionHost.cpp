@@ -0,0 +1,106 @@
+#include "SessionHost.h"
+#include "BoardSnapshot.h"
+#include "HintFactory.h"
+#include "ObjectPool.h"
+#include "SudokuGame.h"
+#include <mutex>
+#include <unordered_map>
+
+struct SessionHost::Shard {
+    using GamePtr = ObjectPool<SudokuGame>::Ptr;
+
+    // Declared before games so that it outlives every game it handed out.
+    ObjectPool<SudokuGame> pool;
+    std::mutex mutex;
+    std::unordered_map<SessionId, GamePtr> games;
+
+    /**
+     * @brief Create and start a game outside the shard lock.
+     */
+    GamePtr newGame(Difficulty difficulty, const PuzzleBank* bank) {
+        GamePtr game = pool.Create(difficulty, HISTORY_LIMIT);
+        game->setPuzzleBank(bank);
+        game->startNewGame();
+        return game;
+    }
+};
+
+SessionHost::SessionHost(std::size_t shardCount, const PuzzleBank* bank)
+    : bank(bank) {
+    shards.resize(shardCount > 0 ? shardCount : 1);
+    for (auto& shard : shards) shard = std::make_unique<Shard>();
+    for (Difficulty d : { Difficulty::EASY, Difficulty::MEDIUM, Difficulty::HARD })
+        hintProviders[static_cast<int>(d)] = CreateHintManager(d);
+}
+
+SessionHost::~SessionHost() = default;
+
+SessionHost::SessionId SessionHost::createSession(Difficulty difficulty) {
+    SessionId id = nextId.fetch_add(1, std::memory_order_relaxed);
+    Shard& shard = shardFor(id);
+    Shard::GamePtr game = shard.newGame(difficulty, bank);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.games.emplace(id, std::move(game));
+    }
+    liveSessions.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+bool SessionHost::startNewGame(SessionId id, Difficulty difficulty) {
+    Shard& shard = shardFor(id);
+    Shard::GamePtr game = shard.newGame(difficulty, bank);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.games.find(id);
+    if (it == shard.games.end()) return false;
+    // The old game ends up in game and is freed after the lock is released.
+    it->second.swap(game);
+    return true;
+}
+
+bool SessionHost::setValue(SessionId id, int row, int col, int value, bool& accepted) {
+    Shard& shard = shardFor(id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.games.find(id);
+    if (it == shard.games.end()) return false;
+    accepted = it->second->setValue(row, col, value);
+    return true;
+}
+
+bool SessionHost::getValue(SessionId id, int row, int col, int& value) {
+    Shard& shard = shardFor(id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.games.find(id);
+    if (it == shard.games.end()) return false;
+    value = it->second->getValue(row, col);
+    return true;
+}
+
+bool SessionHost::hint(SessionId id, std::optional<Hint>& hint) {
+    std::optional<BoardSnapshot> board;
+    {
+        Shard& shard = shardFor(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.games.find(id);
+        if (it == shard.games.end()) return false;
+        board.emplace(*it->second);
+    }
+
+    hint = hintProviders[static_cast<int>(board->getCurrentDifficulty())]->next(*board);
+    return true;
+}
+
+bool SessionHost::endSession(SessionId id) {
+    Shard::GamePtr game;
+    {
+        Shard& shard = shardFor(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.games.find(id);
+        if (it == shard.games.end()) return false;
+        game = std::move(it->second);
+        shard.games.erase(it);
+    }
+    liveSessions.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "Difficulty.h"
+#include "Hint.h"
+#include "IHintProvider.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+class SudokuGame;
+class PuzzleBank;
+
+/**
+ * @brief Owns many concurrent games, one per player session.
+ *
+ * Sessions are spread over shards by id; each shard has its own lock, so
+ * requests for different sessions rarely contend. Slow work never runs under
+ * a shard lock: new puzzles are generated before the game is inserted, and
+ * hints are computed on a BoardSnapshot copied under the lock. A request
+ * therefore holds its lock only for a map lookup and a single game call.
+ *
+ * Each shard allocates its games from its own ObjectPool, so sessions that
+ * come and go reuse the memory of ended games instead of hitting the heap.
+ *
+ * All methods are thread-safe. Requests for one session are serialized by
+ * its shard's lock.
+ */
+class SessionHost {
+public:
+    using SessionId = std::uint64_t;
+
+    /** @brief Moves each hosted game can undo; keeps a game around 1.5 KiB. */
+    static constexpr std::size_t HISTORY_LIMIT = 128;
+
+    /**
+     * @param shardCount Number of independently locked shards.
+     * @param bank Optional seed bank used to create puzzles without running the
+     *        generator; not owned and must outlive the host.
+     */
+    explicit SessionHost(std::size_t shardCount = 64, const PuzzleBank* bank = nullptr);
+    ~SessionHost();
+
+    SessionHost(const SessionHost&) = delete;
+    SessionHost& operator=(const SessionHost&) = delete;
+
+    /**
+     * @brief Open a session with a freshly started game.
+     *
+     * @return Id of the new session (never 0).
+     */
+    SessionId createSession(Difficulty difficulty);
+
+    /**
+     * @brief Replace a session's game with a new one.
+     *
+     * @return false if the session does not exist.
+     */
+    bool startNewGame(SessionId id, Difficulty difficulty);
+
+    /**
+     * @brief Make a move in a session's game.
+     *
+     * @param accepted Receives SudokuGame::setValue's result.
+     * @return false if the session does not exist.
+     */
+    bool setValue(SessionId id, int row, int col, int value, bool& accepted);
+
+    /**
+     * @brief Read a cell of a session's game.
+     *
+     * @param value Receives SudokuGame::getValue's result.
+     * @return false if the session does not exist.
+     */
+    bool getValue(SessionId id, int row, int col, int& value);
+
+    /**
+     * @brief Compute a hint for a session's current board.
+     *
+     * @param hint Receives the hint, or std::nullopt when no strategy found one.
+     * @return false if the session does not exist.
+     */
+    bool hint(SessionId id, std::optional<Hint>& hint);
+
+    /**
+     * @brief Close a session and free its game.
+     *
+     * @return false if the session does not exist.
+     */
+    bool endSession(SessionId id);
+
+    /**
+     * @brief Number of open sessions.
+     */
+    std::size_t sessionCount() const { return liveSessions.load(std::memory_order_relaxed); }
+
+private:
+    struct Shard;
+
+    Shard& shardFor(SessionId id) { return *shards[id % shards.size()]; }
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    const PuzzleBank* bank;
+    // Hint provider per Difficulty, shared by all sessions.
+    std::array<std::unique_ptr<IHintProvider>, 3> hintProviders;
+    std::atomic<SessionId> nextId{ 1 };
+    std::atomic<std::size_t> liveSessions{ 0 };
+};
@@ -0,0 +1,89 @@
+#include "SessionProtocol.h"
+#include <sstream>
+
+namespace {
+    bool ParseDifficulty(const std::string& name, Difficulty& difficulty) {
+        if (name == "easy") difficulty = Difficulty::EASY;
+        else if (name == "medium") difficulty = Difficulty::MEDIUM;
+        else if (name == "hard") difficulty = Difficulty::HARD;
+        else return false;
+        return true;
+    }
+
+    const char* HintTypeName(HintType type) {
+        switch (type) {
+        case HintType::NakedSingle: return "naked_single";
+        case HintType::HiddenSingle: return "hidden_single";
+        case HintType::CandidateList: return "candidate_list";
+        case HintType::SafeCell: return "safe_cell";
+        case HintType::LocalReasoning: return "local_reasoning";
+        }
+        return "unknown";
+    }
+
+    const std::string UNKNOWN_SESSION = "ERR unknown session";
+    const std::string BAD_REQUEST = "ERR bad request";
+}
+
+SessionProtocol::SessionProtocol(SessionHost& host) : host(host) {
+}
+
+std::string SessionProtocol::handle(const std::string& request) {
+    std::istringstream in(request);
+    std::string command;
+    in >> command;
+
+    SessionHost::SessionId id = 0;
+    std::string extra;
+
+    if (command == "NEW") {
+        std::string name;
+        Difficulty difficulty;
+        if (!(in >> name) || !ParseDifficulty(name, difficulty) || in >> extra) return BAD_REQUEST;
+        return "OK " + std::to_string(host.createSession(difficulty));
+    }
+
+    // Every other request addresses an existing session.
+    if (command != "START" && command != "SET" && command != "GET" && command != "HINT" && command != "END") {
+        return "ERR unknown command";
+    }
+    if (!(in >> id)) return BAD_REQUEST;
+
+    if (command == "START") {
+        std::string name;
+        Difficulty difficulty;
+        if (!(in >> name) || !ParseDifficulty(name, difficulty) || in >> extra) return BAD_REQUEST;
+        return host.startNewGame(id, difficulty) ? "OK" : UNKNOWN_SESSION;
+    }
+
+    if (command == "SET") {
+        int row, col, value;
+        if (!(in >> row >> col >> value) || in >> extra) return BAD_REQUEST;
+        bool accepted = false;
+        if (!host.setValue(id, row, col, value, accepted)) return UNKNOWN_SESSION;
+        return accepted ? "OK ACCEPTED" : "OK REJECTED";
+    }
+
+    if (command == "GET") {
+        int row, col;
+        if (!(in >> row >> col) || in >> extra) return BAD_REQUEST;
+        int value = 0;
+        if (!host.getValue(id, row, col, value)) return UNKNOWN_SESSION;
+        return "OK " + std::to_string(value);
+    }
+
+    if (command == "HINT") {
+        if (in >> extra) return BAD_REQUEST;
+        std::optional<Hint> hint;
+        if (!host.hint(id, hint)) return UNKNOWN_SESSION;
+        if (!hint) return "OK NONE";
+        std::string response = std::string("OK ") + HintTypeName(hint->type) + " " + std::to_string(hint->row) + " " +
+            std::to_string(hint->col) + " " + std::to_string(hint->value);
+        for (int candidate : hint->candidates) response += " " + std::to_string(candidate);
+        return response;
+    }
+
+    // END
+    if (in >> extra) return BAD_REQUEST;
+    return host.endSession(id) ? "OK" : UNKNOWN_SESSION;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "SessionHost.h"
+#include <string>
+
+/**
+ * @brief Text request protocol for a SessionHost, independent of the transport.
+ *
+ * Every request is one line and gets one response line:
+ *
+ *     NEW <easy|medium|hard>          -> OK <session id>
+ *     START <id> <easy|medium|hard>   -> OK
+ *     SET <id> <row> <col> <value>    -> OK ACCEPTED | OK REJECTED
+ *     GET <id> <row> <col>            -> OK <value>
+ *     HINT <id>                       -> OK <type> <row> <col> <value> [<c1> <c2> ...] | OK NONE
+ *     END <id>                        -> OK
+ *
+ * A hint's type is one of naked_single, hidden_single, candidate_list,
+ * safe_cell or local_reasoning. Its value is 0 when the hint does not reveal
+ * one, and candidate digits, if any, follow it.
+ *
+ * Failures answer "ERR <reason>". The socket server in SudokuHost feeds
+ * lines from each connection through handle(); tests call it directly.
+ */
+class SessionProtocol {
+public:
+    /**
+     * @param host Host the requests are applied to; must outlive the protocol.
+     */
+    explicit SessionProtocol(SessionHost& host);
+
+    /**
+     * @brief Execute one request line.
+     *
+     * @param request Request without the trailing newline.
+     * @return Response without the trailing newline.
+     */
+    std::string handle(const std::string& request);
+
+private:
+    SessionHost& host;
+};
@@ -0,0 +1,116 @@
+#include "SessionRecorder.h"
+#include "SudokuGame.h"
+#include <algorithm>
+#include <fstream>
+
+namespace {
+    const char LOG_MAGIC[4] = { 'S', 'D', 'K', 'R' };
+    const std::size_t EVENT_SIZE = 8;
+    const std::size_t RESERVED_EVENTS = 4096;
+
+    void PutU32(std::uint8_t* out, std::uint32_t value) {
+        for (int i = 0; i < 4; i++) out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+
+    std::uint32_t GetU32(const std::uint8_t* in) {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; i++) value |= static_cast<std::uint32_t>(in[i]) << (8 * i);
+        return value;
+    }
+}
+
+bool SessionLog::Write(const std::string& path) const {
+    std::vector<std::uint8_t> bytes(4 + 1 + GameSave::SIZE + 4 + events.size() * EVENT_SIZE);
+    std::uint8_t* out = bytes.data();
+    for (int i = 0; i < 4; i++) *out++ = static_cast<std::uint8_t>(LOG_MAGIC[i]);
+    *out++ = VERSION;
+    for (std::uint8_t b : start) *out++ = b;
+    PutU32(out, static_cast<std::uint32_t>(events.size()));
+    out += 4;
+    for (const SessionEvent& e : events) {
+        PutU32(out, e.timeMs);
+        out[4] = static_cast<std::uint8_t>(e.type);
+        out[5] = e.cell;
+        out[6] = e.value;
+        out[7] = e.result ? 1 : 0;
+        out += EVENT_SIZE;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+bool SessionLog::Read(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    std::uint8_t header[4 + 1 + GameSave::SIZE + 4];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+    for (int i = 0; i < 4; i++)
+        if (header[i] != static_cast<std::uint8_t>(LOG_MAGIC[i])) return false;
+    if (header[4] != VERSION) return false;
+
+    std::copy(header + 5, header + 5 + GameSave::SIZE, start.begin());
+    std::uint32_t count = GetU32(header + 5 + GameSave::SIZE);
+
+    std::vector<std::uint8_t> bytes(static_cast<std::size_t>(count) * EVENT_SIZE);
+    if (!file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) return false;
+
+    events.resize(count);
+    const std::uint8_t* in = bytes.data();
+    for (SessionEvent& e : events) {
+        if (in[4] > static_cast<std::uint8_t>(SessionEvent::Type::Hint)) return false;
+        e.timeMs = GetU32(in);
+        e.type = static_cast<SessionEvent::Type>(in[4]);
+        e.cell = in[5];
+        e.value = in[6];
+        e.result = in[7] != 0;
+        in += EVENT_SIZE;
+    }
+    return true;
+}
+
+SessionRecorder::SessionRecorder() : startTime(std::chrono::steady_clock::now()) {
+    log.events.reserve(RESERVED_EVENTS);
+}
+
+void SessionRecorder::Begin(const SudokuGame& game) {
+    game.saveState(log.start);
+    log.events.clear();
+    startTime = std::chrono::steady_clock::now();
+}
+
+void SessionRecorder::Record(SessionEvent::Type type, int cell, int value, bool result) {
+    SessionEvent e;
+    e.timeMs = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count());
+    e.type = type;
+    e.cell = static_cast<std::uint8_t>(cell);
+    e.value = static_cast<std::uint8_t>(value);
+    e.result = result;
+    log.events.push_back(e);
+}
+
+void SessionRecorder::RecordSetValue(int row, int col, int value, bool accepted) {
+    Record(SessionEvent::Type::SetValue, row * 9 + col, value, accepted);
+}
+
+void SessionRecorder::RecordReset() {
+    Record(SessionEvent::Type::Reset, 0, 0, true);
+}
+
+void SessionRecorder::RecordUndo(bool applied) {
+    Record(SessionEvent::Type::Undo, 0, 0, applied);
+}
+
+void SessionRecorder::RecordRedo(bool applied) {
+    Record(SessionEvent::Type::Redo, 0, 0, applied);
+}
+
+void SessionRecorder::RecordHint(const std::optional<Hint>& hint) {
+    if (hint && hint->row >= 0 && hint->col >= 0) Record(SessionEvent::Type::Hint, hint->row * 9 + hint->col, hint->value, true);
+    else if (hint) Record(SessionEvent::Type::Hint, 0, hint->value, true);
+    else Record(SessionEvent::Type::Hint, 0, 0, false);
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include "GameSave.h"
+#include "Hint.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+class SudokuGame;
+
+/**
+ * @brief One recorded player action.
+ */
+struct SessionEvent {
+    enum class Type : std::uint8_t {
+        SetValue,
+        Reset,
+        Undo,
+        Redo,
+        Hint
+    };
+
+    /** @brief Milliseconds since the session started. */
+    std::uint32_t timeMs = 0;
+    Type type = Type::SetValue;
+    /** @brief Cell index (row * 9 + col) for SetValue and Hint, 0 otherwise. */
+    std::uint8_t cell = 0;
+    /** @brief Value entered, or the value a hint revealed. */
+    std::uint8_t value = 0;
+    /** @brief What the call returned: move accepted, undo/redo applied or hint found. */
+    bool result = false;
+};
+
+/**
+ * @brief A recorded session: the game as it started plus every action on it.
+ *
+ * On disk a log is the magic "SDKR", a version byte, the GameSave record of
+ * the starting game, a 32-bit event count and 8 bytes per event, so a long
+ * session stays a few kilobytes.
+ */
+struct SessionLog {
+    /** @brief Current file format version. */
+    static constexpr std::uint8_t VERSION = 1;
+
+    /** @brief The game when recording started. */
+    GameSave::Buffer start{};
+    std::vector<SessionEvent> events;
+
+    /**
+     * @brief Write the log to a file.
+     *
+     * @return false if the file could not be written.
+     */
+    bool Write(const std::string& path) const;
+
+    /**
+     * @brief Read a log written by Write().
+     *
+     * @return false if the file is missing, truncated or from another format version.
+     */
+    bool Read(const std::string& path);
+};
+
+/**
+ * @brief Captures the calls made on a game so they can be replayed later.
+ *
+ * Attach a recorder with SudokuGame::setRecorder(); the game then reports
+ * every setValue, reset, undo and redo. Hints are computed outside the game,
+ * so whoever shows a hint reports it with RecordHint(). Recording appends a
+ * fixed-size event to a preallocated buffer, so it adds no work beyond an
+ * occasional reallocation on very long sessions.
+ */
+class SessionRecorder {
+public:
+    SessionRecorder();
+
+    /**
+     * @brief Start a new session on game, dropping the events recorded so far.
+     */
+    void Begin(const SudokuGame& game);
+
+    void RecordSetValue(int row, int col, int value, bool accepted);
+    void RecordReset();
+    void RecordUndo(bool applied);
+    void RecordRedo(bool applied);
+    void RecordHint(const std::optional<Hint>& hint);
+
+    /**
+     * @brief Number of events recorded in the current session.
+     */
+    std::size_t Size() const { return log.events.size(); }
+
+    /**
+     * @brief The current session.
+     */
+    const SessionLog& Log() const { return log; }
+
+private:
+    void Record(SessionEvent::Type type, int cell, int value, bool result);
+
+    SessionLog log;
+    std::chrono::steady_clock::time_point startTime;
+};
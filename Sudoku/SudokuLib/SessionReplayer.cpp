@@ -0,0 +1,51 @@
+#include "SessionReplayer.h"
+#include "SudokuGame.h"
+#include "HintFactory.h"
+#include <chrono>
+
+SessionReplayer::SessionReplayer(bool replayHints) {
+    if (!replayHints) return;
+    for (Difficulty d : { Difficulty::EASY, Difficulty::MEDIUM, Difficulty::HARD })
+        hints[static_cast<int>(d)] = CreateHintManager(d);
+}
+
+bool SessionReplayer::Replay(const SessionLog& log, Result& result) const {
+    SudokuGame game;
+    if (!game.loadState(log.start)) return false;
+
+    const IHintProvider* hintProvider = hints[static_cast<int>(game.getCurrentDifficulty())].get();
+
+    auto begin = std::chrono::steady_clock::now();
+    for (const SessionEvent& e : log.events) {
+        bool matches = true;
+        switch (e.type) {
+        case SessionEvent::Type::SetValue:
+            matches = game.setValue(e.cell / 9, e.cell % 9, e.value) == e.result;
+            break;
+        case SessionEvent::Type::Reset:
+            game.reset();
+            break;
+        case SessionEvent::Type::Undo:
+            matches = game.undo() == e.result;
+            break;
+        case SessionEvent::Type::Redo:
+            matches = game.redo() == e.result;
+            break;
+        case SessionEvent::Type::Hint:
+            if (!hintProvider) {
+                result.skippedHints++;
+            }
+            else {
+                // Strategies are picked at random, so only availability is compared.
+                matches = hintProvider->next(game).has_value() == e.result;
+            }
+            break;
+        }
+        if (!matches) result.mismatches++;
+    }
+    result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    result.sessions++;
+    result.events += log.events.size();
+    return true;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "IHintProvider.h"
+#include "SessionRecorder.h"
+#include <array>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Re-executes recorded sessions against SudokuGame without any UI.
+ *
+ * Each session starts from the game stored in its log (the generator is not
+ * run) and its events are applied back to back, ignoring their timestamps.
+ * Every call's result is compared with the recorded one, so a change in the
+ * game logic that alters the outcome of a real player's move shows up as a
+ * mismatch. Hint requests are answered by the same per-difficulty hint
+ * managers the game uses (see CreateHintManager); since those choose among
+ * strategies at random, only whether a hint was found is compared.
+ */
+class SessionReplayer {
+public:
+    /**
+     * @brief Totals for one or more replayed sessions.
+     */
+    struct Result {
+        std::size_t sessions = 0;
+        std::size_t events = 0;
+        /** @brief Events whose result differed from the recording. */
+        std::size_t mismatches = 0;
+        /** @brief Hint events skipped because no provider was given. */
+        std::size_t skippedHints = 0;
+        /** @brief Time spent applying events, excluding setup. */
+        double seconds = 0.0;
+    };
+
+    /**
+     * @param replayHints Replay hint requests; when false they are skipped.
+     */
+    explicit SessionReplayer(bool replayHints = true);
+
+    /**
+     * @brief Replay one session and add its totals to result.
+     *
+     * @return false if the log's starting game cannot be loaded.
+     */
+    bool Replay(const SessionLog& log, Result& result) const;
+
+private:
+    // Hint provider per Difficulty, empty when hints are skipped.
+    std::array<std::unique_ptr<IHintProvider>, 3> hints;
+};
@@ -41,6 +41,8 @@ SudokuBoard::SudokuBoard() {
 
 void SudokuBoard::Clear() {
     std::fill(&board[0][0], &board[0][0] + 81, 0);
+    std::fill(digitCells, digitCells + 10, CellMask());
+    digitCells[0] = CellMask::All();
 }
 
 int SudokuBoard::Get(int r, int c) const {
@@ -50,9 +52,18 @@ int SudokuBoard::Get(int r, int c) const {
 
 void SudokuBoard::Set(int r, int c, int v) {
     if (r < 0 || r >= 9 || c < 0 || c >= 9) return;
+    const int cell = r * 9 + c;
+    const int old = board[r][c];
+    if (old >= 0 && old <= 9) digitCells[old].Reset(cell);
+    if (v >= 0 && v <= 9) digitCells[v].Set(cell);
     board[r][c] = v;
 }
 
+CellMask SudokuBoard::CellsWith(int digit) const {
+    if (digit < 0 || digit > 9) return CellMask();
+    return digitCells[digit];
+}
+
 bool SudokuBoard::IsInitial(int r, int c) const {
     if (r < 0 || r >= 9 || c < 0 || c >= 9) return false;
     return initialCells[r][c];
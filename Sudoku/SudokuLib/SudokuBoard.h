@@ -1,11 +1,14 @@
 #pragma once
 #include "CellState.h"
+#include "BoardView.h"
+#include "CellMask.h"
 
 /**
  * @brief Represents the Sudoku board state including mutable cells, initial cells and the solution.
  *
  * SudokuBoard provides accessor and mutator functions for a 9x9 Sudoku grid, tracks which
  * cells are part of the initial puzzle (fixed) and stores the full solution separately.
+ * For every digit it also keeps the set of cells holding it, updated by Set().
  */
 class SudokuBoard {
 public:
@@ -104,6 +107,19 @@ public:
      */
     CellState GetCellState(int r, int c) const;
 
+    /**
+     * @brief Cells currently holding a digit.
+     *
+     * @param digit 1-9, or 0 for the empty cells.
+     * @return Set of cells; empty for digits out of range.
+     */
+    CellMask CellsWith(int digit) const;
+
+    /**
+     * @brief View of the current values, initial marks and digit sets without copying them.
+     */
+    BoardView View() const { return { &board[0][0], &initialCells[0][0], digitCells }; }
+
 private:
     /**
      * @brief Current board values (0 means empty).
@@ -115,6 +131,11 @@ private:
      */
     bool initialCells[9][9];
 
+    /**
+     * @brief Cells holding each value; index 0 holds the empty cells.
+     */
+    CellMask digitCells[10];
+
     /**
      * @brief Stored complete solution for the puzzle.
      */
@@ -0,0 +1,293 @@
+#include "SudokuCanonical.h"
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace {
+    /**
+     * @brief A partial transform: destination rows 0..row-1 are already fixed.
+     */
+    struct SearchState {
+        std::uint8_t rowMap[9];
+        std::uint8_t colMap[9];
+        std::uint8_t digitMap[10];
+        std::uint8_t nextDigit;
+        bool transpose;
+        std::uint16_t usedRows;
+    };
+
+    using ColumnPermutation = std::array<std::uint8_t, 9>;
+
+    // All 6^4 = 1296 column permutations that keep stacks together.
+    const std::array<ColumnPermutation, 1296>& ColumnPermutations() {
+        static const std::array<ColumnPermutation, 1296> table = [] {
+            static const int perm3[6][3] = {
+                { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 }
+            };
+            std::array<ColumnPermutation, 1296> perms{};
+            for (int p = 0; p < 1296; ++p) {
+                int stackOrder = p % 6;
+                int rest = p / 6;
+                for (int g = 0; g < 3; ++g) {
+                    int inner = rest % 6;
+                    rest /= 6;
+                    for (int i = 0; i < 3; ++i)
+                        perms[p][g * 3 + i] = static_cast<std::uint8_t>(perm3[stackOrder][g] * 3 + perm3[inner][i]);
+                }
+            }
+            return perms;
+        }();
+        return table;
+    }
+
+    /**
+     * @brief Identical rows, columns, bands and stacks of one orientation.
+     *
+     * Swapping two identical lines in the same band (or stack), or two
+     * identical bands (or stacks), leaves the grid unchanged, so the search only
+     * tries them in ascending index order. This is what keeps sparse grids,
+     * whose empty rows and columns are all alike, from multiplying states.
+     */
+    struct LineSymmetry {
+        // Bit j of sameRow[i] is set when rows i and j hold the same values.
+        std::uint16_t sameRow[9] = {};
+        std::uint16_t sameCol[9] = {};
+        bool sameBand[3][3] = {};
+        bool sameStack[3][3] = {};
+        bool anyColumns = false;
+
+        explicit LineSymmetry(const int* grid) {
+            for (int i = 0; i < 9; ++i) {
+                for (int j = 0; j < 9; ++j) {
+                    bool rows = true, cols = true;
+                    for (int k = 0; k < 9; ++k) {
+                        rows = rows && grid[i * 9 + k] == grid[j * 9 + k];
+                        cols = cols && grid[k * 9 + i] == grid[k * 9 + j];
+                    }
+                    if (rows) sameRow[i] |= static_cast<std::uint16_t>(1 << j);
+                    if (cols) sameCol[i] |= static_cast<std::uint16_t>(1 << j);
+                    if (cols && i != j) anyColumns = true;
+                }
+            }
+            for (int a = 0; a < 3; ++a) {
+                for (int b = 0; b < 3; ++b) {
+                    sameBand[a][b] = sameStack[a][b] = true;
+                    for (int i = 0; i < 3; ++i) {
+                        sameBand[a][b] = sameBand[a][b] && (sameRow[a * 3 + i] & (1 << (b * 3 + i)));
+                        sameStack[a][b] = sameStack[a][b] && (sameCol[a * 3 + i] & (1 << (b * 3 + i)));
+                    }
+                }
+            }
+        }
+
+        // Whether sr is the lowest-numbered unused row it could be swapped with.
+        bool FirstOfItsKind(int sr, std::uint16_t usedRows, bool newBand) const {
+            const int band = sr / 3;
+            const std::uint16_t lower = static_cast<std::uint16_t>((1 << sr) - 1);
+            const std::uint16_t bandRows = static_cast<std::uint16_t>(7 << (band * 3));
+            if (sameRow[sr] & bandRows & lower & ~usedRows) return false;
+            if (newBand) {
+                for (int b = 0; b < band; ++b)
+                    if (sameBand[b][band] && !(usedRows & (7 << (b * 3)))) return false;
+            }
+            return true;
+        }
+
+        // Whether identical columns and stacks keep their source order under perm.
+        bool CanonicalColumns(const ColumnPermutation& perm) const {
+            if (!anyColumns) return true;
+            for (int g = 0; g < 3; ++g) {
+                for (int i = 0; i < 3; ++i)
+                    for (int j = i + 1; j < 3; ++j) {
+                        int a = perm[g * 3 + i], b = perm[g * 3 + j];
+                        if (a > b && (sameCol[a] & (1 << b))) return false;
+                    }
+                for (int h = g + 1; h < 3; ++h) {
+                    int sg = perm[g * 3] / 3, sh = perm[h * 3] / 3;
+                    if (sg > sh && sameStack[sg][sh]) return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    // Relabel one source row through colMap, assigning new digits by first appearance.
+    void EvaluateRow(const int* src, const std::uint8_t* colMap, std::uint8_t digitMap[10], std::uint8_t& nextDigit, int out[9]) {
+        for (int c = 0; c < 9; ++c) {
+            int v = src[colMap[c]];
+            if (v != 0 && digitMap[v] == 0) digitMap[v] = nextDigit++;
+            out[c] = digitMap[v];
+        }
+    }
+
+    // Empty cells of the best first row a source row can produce, as a 9-bit mask
+    // with destination column 0 in the top bit. An empty cell beats any digit, so
+    // only rows whose mask is the largest can start the canonical grid.
+    int BestEmptyMask(const int* src) {
+        int empties[3];
+        for (int s = 0; s < 3; ++s)
+            empties[s] = (src[s * 3] == 0) + (src[s * 3 + 1] == 0) + (src[s * 3 + 2] == 0);
+        // Stacks with the most empty cells first, empty cells first within a stack.
+        if (empties[0] < empties[1]) std::swap(empties[0], empties[1]);
+        if (empties[1] < empties[2]) std::swap(empties[1], empties[2]);
+        if (empties[0] < empties[1]) std::swap(empties[0], empties[1]);
+        int mask = 0;
+        for (int s = 0; s < 3; ++s)
+            mask = (mask << 3) | ((7 << (3 - empties[s])) & 7);
+        return mask;
+    }
+
+    // -1 if a < b, 0 if equal, 1 if a > b.
+    int CompareRows(const int a[9], const int b[9]) {
+        for (int c = 0; c < 9; ++c)
+            if (a[c] != b[c]) return a[c] < b[c] ? -1 : 1;
+        return 0;
+    }
+}
+
+SudokuTransform SudokuCanonical::CanonicalTransform(const int grid[9][9]) {
+    // source[1] is the transposed grid, so a state reads source[transpose][sr * 9 + sc].
+    int source[2][81];
+    bool empty = true;
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c) {
+            source[0][r * 9 + c] = grid[r][c];
+            source[1][c * 9 + r] = grid[r][c];
+            if (grid[r][c] != 0) empty = false;
+        }
+    if (empty) return SudokuTransform::Identity();
+
+    const LineSymmetry symmetry[2] = { LineSymmetry(source[0]), LineSymmetry(source[1]) };
+
+    // Only source rows that can produce the emptiest first row are expanded.
+    int emptyMask[2][9];
+    int bestMask = 0;
+    for (int t = 0; t < 2; ++t)
+        for (int sr = 0; sr < 9; ++sr) {
+            emptyMask[t][sr] = BestEmptyMask(source[t] + sr * 9);
+            if (emptyMask[t][sr] > bestMask) bestMask = emptyMask[t][sr];
+        }
+
+    const auto& perms = ColumnPermutations();
+    // Row 0 yields at most one state per orientation, source row and column
+    // permutation, and no grid tried keeps more at a later row. The buffers are
+    // reserved to that bound once per thread and reused by every call.
+    constexpr std::size_t MAX_STATES = 2 * 9 * 1296;
+    thread_local std::vector<SearchState> states, next;
+    if (states.capacity() < MAX_STATES) {
+        states.reserve(MAX_STATES);
+        next.reserve(MAX_STATES);
+    }
+    states.clear();
+    int best[9], row[9];
+
+    // Row 0: every orientation, source row and column permutation.
+    for (int t = 0; t < 2; ++t) {
+        for (int sr = 0; sr < 9; ++sr) {
+            if (emptyMask[t][sr] != bestMask) continue;
+            if (!symmetry[t].FirstOfItsKind(sr, 0, true)) continue;
+            const int* src = source[t] + sr * 9;
+            for (const auto& perm : perms) {
+                if (!symmetry[t].CanonicalColumns(perm)) continue;
+                std::uint8_t digitMap[10] = { 0 };
+                std::uint8_t nextDigit = 1;
+                EvaluateRow(src, perm.data(), digitMap, nextDigit, row);
+
+                int cmp = states.empty() ? -1 : CompareRows(row, best);
+                if (cmp > 0) continue;
+                if (cmp < 0) {
+                    states.clear();
+                    std::copy(row, row + 9, best);
+                }
+
+                SearchState s;
+                s.rowMap[0] = static_cast<std::uint8_t>(sr);
+                std::copy(perm.begin(), perm.end(), s.colMap);
+                std::copy(digitMap, digitMap + 10, s.digitMap);
+                s.nextDigit = nextDigit;
+                s.usedRows = static_cast<std::uint16_t>(1 << sr);
+                s.transpose = t != 0;
+                states.push_back(s);
+            }
+        }
+    }
+
+    // Rows 1-8: extend the surviving states, keeping only the minimal ones.
+    for (int r = 1; r < 9; ++r) {
+        next.clear();
+        for (const auto& s : states) {
+            const int* grid0 = source[s.transpose ? 1 : 0];
+            const LineSymmetry& same = symmetry[s.transpose ? 1 : 0];
+            for (int sr = 0; sr < 9; ++sr) {
+                if (s.usedRows & (1 << sr)) continue;
+                int band = sr / 3;
+                if (r % 3 == 0) {
+                    // A new band starts: it must be one not used yet.
+                    if (s.usedRows & (7 << (band * 3))) continue;
+                }
+                else if (band != s.rowMap[r - 1] / 3) {
+                    continue;
+                }
+                if (!same.FirstOfItsKind(sr, s.usedRows, r % 3 == 0)) continue;
+
+                std::uint8_t digitMap[10];
+                std::copy(s.digitMap, s.digitMap + 10, digitMap);
+                std::uint8_t nextDigit = s.nextDigit;
+                EvaluateRow(grid0 + sr * 9, s.colMap, digitMap, nextDigit, row);
+
+                int cmp = next.empty() ? -1 : CompareRows(row, best);
+                if (cmp > 0) continue;
+                if (cmp < 0) {
+                    next.clear();
+                    std::copy(row, row + 9, best);
+                }
+
+                SearchState n = s;
+                n.rowMap[r] = static_cast<std::uint8_t>(sr);
+                std::copy(digitMap, digitMap + 10, n.digitMap);
+                n.nextDigit = nextDigit;
+                n.usedRows = static_cast<std::uint16_t>(n.usedRows | (1 << sr));
+                next.push_back(n);
+            }
+        }
+        states.swap(next);
+    }
+
+    const SearchState& winner = states.front();
+    SudokuTransform t;
+    std::copy(winner.rowMap, winner.rowMap + 9, t.rowMap);
+    std::copy(winner.colMap, winner.colMap + 9, t.colMap);
+    std::copy(winner.digitMap, winner.digitMap + 10, t.digitMap);
+    t.transpose = winner.transpose;
+
+    // Digits absent from the grid take the remaining labels in order.
+    int nextDigit = winner.nextDigit;
+    for (int d = 1; d <= 9; ++d)
+        if (t.digitMap[d] == 0) t.digitMap[d] = nextDigit++;
+    return t;
+}
+
+void SudokuCanonical::Canonicalize(const int grid[9][9], int out[9][9]) {
+    CanonicalTransform(grid).Apply(grid, out);
+}
+
+std::uint64_t SudokuCanonical::Hash(const int grid[9][9]) {
+    int canonical[9][9];
+    Canonicalize(grid, canonical);
+
+    std::uint64_t hash = 14695981039346656037ull;
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c) {
+            hash ^= static_cast<std::uint64_t>(canonical[r][c]);
+            hash *= 1099511628211ull;
+        }
+    return hash;
+}
+
+std::uint64_t SudokuCanonical::Hash(const SudokuBoard& board) {
+    int givens[9][9];
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c)
+            givens[r][c] = board.IsInitial(r, c) ? board.Get(r, c) : 0;
+    return Hash(givens);
+}
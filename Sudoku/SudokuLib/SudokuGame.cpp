@@ -166,6 +166,8 @@
 
 
 #include "SudokuGame.h"
+#include "PerfStats.h"
+#include "SessionRecorder.h"
 #include <algorithm>
 #include <vector>
 
@@ -176,19 +178,26 @@ SudokuGame::SudokuGame()
     timer.Reset();
 }
 
-SudokuGame::SudokuGame(Difficulty difficulty)
+SudokuGame::SudokuGame(Difficulty difficulty, std::size_t historyLimit)
     : currentDifficulty(difficulty),
-    remainingAttempts(3) {
+    remainingAttempts(3),
+    journal(historyLimit) {
     timer.Reset();
 }
 
 void SudokuGame::startNewGame() {
+    startNewGame(StopToken());
+}
+
+bool SudokuGame::startNewGame(const StopToken& stop) {
     remainingAttempts = 3;
     timer.Reset();
-    generatePuzzle();
+    journal.Clear();
+    if (!generatePuzzle(stop)) return false;
     timer.Start();
     notifyBoardChanged();
     notifyAttemptsChanged();
+    return true;
 }
 
 void SudokuGame::startNewGame(Difficulty difficulty) {
@@ -197,7 +206,13 @@ void SudokuGame::startNewGame(Difficulty difficulty) {
 }
 
 void SudokuGame::generatePuzzle() {
-    generator.Generate(board, currentDifficulty);
+    generatePuzzle(StopToken());
+}
+
+bool SudokuGame::generatePuzzle(const StopToken& stop) {
+    static PerfChannel& generateTime = PerfStats::Channel("generate");
+    PerfStats::ScopedTimer timing(generateTime);
+    return generator.Generate(board, currentDifficulty, stop);
 }
 
 bool SudokuGame::isSafe(int row, int col, int num) const {
@@ -226,18 +241,29 @@ bool SudokuGame::isValidPosition(int row, int col) const {
 }
 
 bool SudokuGame::setValue(int row, int col, int value) {
+    bool accepted = applyValue(row, col, value);
+    if (recorder) recorder->RecordSetValue(row, col, value, accepted);
+    return accepted;
+}
+
+bool SudokuGame::applyValue(int row, int col, int value) {
     if (!isValidPosition(row, col)) return false;
     if (value < 0 || value > 9) return false;
     if (board.IsInitial(row, col)) return false;
 
+    const int oldValue = board.Get(row, col);
+    const int cell = row * 9 + col;
+
     if (value == 0) {
         board.Set(row, col, 0);
+        if (oldValue != 0) journal.Record({ cell, oldValue, 0, false });
         notifyBoardChanged();
         return true;
     }
 
     if (isValidMove(row, col, value)) {
         board.Set(row, col, value);
+        if (oldValue != value) journal.Record({ cell, oldValue, value, false });
         notifyBoardChanged();
         if (isComplete()) {
             timer.Stop();
@@ -247,6 +273,7 @@ bool SudokuGame::setValue(int row, int col, int value) {
     }
     else {
         remainingAttempts--;
+        journal.Record({ cell, oldValue, value, true });
         notifyAttemptsChanged();
         if (remainingAttempts <= 0) {
             timer.Stop();
@@ -299,12 +326,15 @@ int SudokuGame::getRemainingAttempts() const { return remainingAttempts; }
 Difficulty SudokuGame::getCurrentDifficulty() const { return currentDifficulty; }
 
 void SudokuGame::reset() {
+    if (recorder) recorder->RecordReset();
+
     for (int r = 0; r < 9; ++r)
         for (int c = 0; c < 9; ++c)
             if (!board.IsInitial(r, c))
                 board.Set(r, c, 0);
 
     remainingAttempts = 3;
+    journal.Clear();
     timer.Reset();
     timer.Start();
     notifyBoardChanged();
@@ -316,39 +346,194 @@ int SudokuGame::getElapsedTime() const {
 }
 
 void SudokuGame::attachObserver(IObserver* observer) {
-    if (!observer) return;
-    // avoid duplicates
-    auto it = std::find(observers.begin(), observers.end(), observer);
-    if (it == observers.end()) observers.push_back(observer);
+    observers.Attach(observer);
 }
 
 void SudokuGame::detachObserver(IObserver* observer) {
-    if (!observer) return;
-    observers.remove(observer);
+    observers.Detach(observer);
+}
+
+void SudokuGame::setDispatchMode(ObserverDispatcher::Mode mode) {
+    observers.SetMode(mode);
+}
+
+std::size_t SudokuGame::deliverEvents() {
+    return observers.Deliver();
+}
+
+bool SudokuGame::isInProgress() const {
+    return remainingAttempts > 0 && !isComplete();
+}
+
+// Rejected moves stay in the journal so the history matches what was played,
+// but undo and redo step over them. A game in progress holds at most two, so
+// these scans stop after a few records.
+bool SudokuGame::canUndo() const {
+    if (!isInProgress()) return false;
+    for (std::size_t i = 0; i < journal.UndoCount(); ++i)
+        if (!journal.PeekUndo(i).attemptConsumed) return true;
+    return false;
+}
+
+bool SudokuGame::canRedo() const {
+    if (!isInProgress()) return false;
+    for (std::size_t i = 0; i < journal.RedoCount(); ++i)
+        if (!journal.PeekRedo(i).attemptConsumed) return true;
+    return false;
+}
+
+bool SudokuGame::undo() {
+    const bool applied = canUndo();
+    if (recorder) recorder->RecordUndo(applied);
+    if (!applied) return false;
+
+    MoveJournal::Move move = journal.Undo();
+    while (move.attemptConsumed) move = journal.Undo();
+
+    board.Set(move.cell / 9, move.cell % 9, move.oldValue);
+    notifyBoardChanged();
+    return true;
+}
+
+bool SudokuGame::redo() {
+    const bool applied = canRedo();
+    if (recorder) recorder->RecordRedo(applied);
+    if (!applied) return false;
+
+    MoveJournal::Move move = journal.Redo();
+    while (move.attemptConsumed) move = journal.Redo();
+
+    board.Set(move.cell / 9, move.cell % 9, move.newValue);
+    notifyBoardChanged();
+    if (isComplete()) {
+        timer.Stop();
+        notifyGameComplete();
+    }
+    return true;
+}
+
+void SudokuGame::publishSnapshot() {
+    if (publisher) publisher->Publish(*this);
+}
+
+const BoardPublisher& SudokuGame::enableSnapshotPublishing() {
+    if (!publisher) {
+        publisher = std::make_unique<BoardPublisher>();
+        publisher->Publish(*this);
+    }
+    return *publisher;
 }
 
 void SudokuGame::notifyBoardChanged() {
-    std::vector<IObserver*> copy;
-    copy.reserve(observers.size());
-    for (auto* o : observers) if (o) copy.push_back(o);
-    for (auto* obs : copy) if (obs) obs->onBoardChanged();
+    // Readers on other threads see the change no later than observers do.
+    publishSnapshot();
+    observers.BoardChanged();
 }
 
 void SudokuGame::notifyGameComplete() {
-    std::vector<IObserver*> copy;
-    copy.reserve(observers.size());
-    for (auto* o : observers) if (o) copy.push_back(o);
-    for (auto* obs : copy) if (obs) obs->onGameComplete();
+    observers.GameComplete();
 }
 
 void SudokuGame::notifyAttemptsChanged() {
-    std::vector<IObserver*> copy;
-    copy.reserve(observers.size());
-    for (auto* o : observers) if (o) copy.push_back(o);
-    for (auto* obs : copy) if (obs) obs->onAttemptsChanged(remainingAttempts);
+    publishSnapshot();
+    observers.AttemptsChanged(remainingAttempts);
 }
 
 int SudokuGame::getSolutionValue(int row, int col) const {
     if (isValidPosition(row, col)) return board.GetSolution(row, col);
     return 0;
-}
\ No newline at end of file
+}
+
+void SudokuGame::setPuzzleBank(const PuzzleBank* bank) {
+    generator.SetPuzzleBank(bank);
+}
+
+void SudokuGame::setRecorder(SessionRecorder* sessionRecorder) {
+    recorder = sessionRecorder;
+}
+
+void SudokuGame::setHistoryLimit(std::size_t moves) {
+    journal = MoveJournal(moves);
+}
+
+namespace {
+    const std::uint8_t SAVE_MAGIC[4] = { 'S', 'D', 'K', 'S' };
+    const std::size_t VALUES_OFFSET = 11;
+    const std::size_t SOLUTION_OFFSET = VALUES_OFFSET + 41;
+    const std::size_t FIXED_OFFSET = SOLUTION_OFFSET + 41;
+    const std::size_t CHECKSUM_OFFSET = GameSave::SIZE - 4;
+
+    void WriteU32(GameSave::Buffer& out, std::size_t offset, std::uint32_t value) {
+        for (int i = 0; i < 4; i++) out[offset + i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+
+    std::uint32_t ReadU32(const GameSave::Buffer& in, std::size_t offset) {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; i++) value |= static_cast<std::uint32_t>(in[offset + i]) << (8 * i);
+        return value;
+    }
+
+    // Cell values packed two per byte, low nibble first.
+    int ReadNibble(const GameSave::Buffer& in, std::size_t offset, int cell) {
+        std::uint8_t byte = in[offset + cell / 2];
+        return cell % 2 == 0 ? byte & 0xF : byte >> 4;
+    }
+}
+
+void SudokuGame::saveState(GameSave::Buffer& out) const {
+    out.fill(0);
+    for (int i = 0; i < 4; i++) out[i] = SAVE_MAGIC[i];
+    out[4] = GameSave::VERSION;
+    out[5] = static_cast<std::uint8_t>(currentDifficulty);
+    out[6] = static_cast<std::uint8_t>(remainingAttempts < 0 ? 0 : remainingAttempts);
+    WriteU32(out, 7, static_cast<std::uint32_t>(timer.GetElapsedSeconds()));
+
+    for (int cell = 0; cell < 81; cell++) {
+        int r = cell / 9, c = cell % 9;
+        int shift = cell % 2 == 0 ? 0 : 4;
+        out[VALUES_OFFSET + cell / 2] |= static_cast<std::uint8_t>(board.Get(r, c) << shift);
+        out[SOLUTION_OFFSET + cell / 2] |= static_cast<std::uint8_t>(board.GetSolution(r, c) << shift);
+        if (board.IsInitial(r, c)) out[FIXED_OFFSET + cell / 8] |= static_cast<std::uint8_t>(1 << (cell % 8));
+    }
+
+    WriteU32(out, CHECKSUM_OFFSET, GameSave::Checksum(out));
+}
+
+bool SudokuGame::loadState(const GameSave::Buffer& in) {
+    for (int i = 0; i < 4; i++)
+        if (in[i] != SAVE_MAGIC[i]) return false;
+    if (in[4] != GameSave::VERSION) return false;
+    if (ReadU32(in, CHECKSUM_OFFSET) != GameSave::Checksum(in)) return false;
+    if (in[5] > static_cast<std::uint8_t>(Difficulty::HARD)) return false;
+    if (in[6] > 3) return false;
+
+    int values[9][9];
+    int solution[9][9];
+    bool fixed[9][9];
+    for (int cell = 0; cell < 81; cell++) {
+        int r = cell / 9, c = cell % 9;
+        values[r][c] = ReadNibble(in, VALUES_OFFSET, cell);
+        solution[r][c] = ReadNibble(in, SOLUTION_OFFSET, cell);
+        fixed[r][c] = (in[FIXED_OFFSET + cell / 8] >> (cell % 8)) & 1;
+        if (values[r][c] > 9 || solution[r][c] < 1 || solution[r][c] > 9) return false;
+        if (fixed[r][c] && values[r][c] != solution[r][c]) return false;
+    }
+
+    currentDifficulty = static_cast<Difficulty>(in[5]);
+    remainingAttempts = in[6];
+    board.SetSolution(solution);
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c) {
+            board.Set(r, c, values[r][c]);
+            board.MarkInitial(r, c, fixed[r][c]);
+        }
+    journal.Clear();
+
+    timer.Reset();
+    timer.SetElapsedSeconds(static_cast<int>(ReadU32(in, 7)));
+    if (remainingAttempts > 0 && !isComplete()) timer.Start();
+
+    notifyBoardChanged();
+    notifyAttemptsChanged();
+    return true;
+}
@@ -6,7 +6,14 @@
 #include "SudokuBoard.h"
 #include "SudokuGenerator.h"
 #include "GameTimer.h"
-#include <list>
+#include "CancellationToken.h"
+#include "MoveJournal.h"
+#include "GameSave.h"
+#include "BoardPublisher.h"
+#include "ObserverDispatcher.h"
+#include <memory>
+
+class SessionRecorder;
 
 /**
  * @brief Concrete implementation of ISudokuGame that manages Sudoku gameplay.
@@ -40,13 +47,33 @@ private:
     /**
      * @brief Observers registered to receive game updates (UI, etc.).
      */
-    std::list<IObserver*> observers;
+    ObserverDispatcher observers;
 
     /**
      * @brief Timer tracking the elapsed play time for the current game.
      */
     GameTimer timer;
 
+    /**
+     * @brief Undo/redo history of the moves made since the game started or was reset.
+     */
+    MoveJournal journal;
+
+    /**
+     * @brief Receives every player action when a session is being recorded (not owned).
+     */
+    SessionRecorder* recorder = nullptr;
+
+    /**
+     * @brief Snapshot published after every change once enableSnapshotPublishing() was called.
+     */
+    std::unique_ptr<BoardPublisher> publisher;
+
+    /**
+     * @brief Publish the current state if publishing is enabled.
+     */
+    void publishSnapshot();
+
     /**
      * @brief Notify observers that the board has changed.
      */
@@ -83,6 +110,25 @@ private:
      */
     bool isValidPosition(int row, int col) const;
 
+    /**
+     * @brief Check whether moves may still be undone or redone.
+     *
+     * @return false once the puzzle is solved or the attempts are used up.
+     */
+    bool isInProgress() const;
+
+    /**
+     * @brief Apply a move for setValue(), without recording it.
+     */
+    bool applyValue(int row, int col, int value);
+
+    /**
+     * @brief Generate a puzzle for the current difficulty unless stop is requested.
+     *
+     * @return false when generation was cancelled.
+     */
+    bool generatePuzzle(const StopToken& stop);
+
 public:
     /**
      * @brief Construct a SudokuGame using the default difficulty (MEDIUM).
@@ -92,9 +138,13 @@ public:
     /**
      * @brief Construct a SudokuGame with the specified difficulty.
      *
+     * The undo history is allocated here, so moves never allocate.
+     *
      * @param difficulty Difficulty level to use for generated puzzles.
+     * @param historyLimit Number of moves that can be undone, at least 1; hosts
+     *        holding many games at once lower it to save memory.
      */
-    explicit SudokuGame(Difficulty difficulty);
+    explicit SudokuGame(Difficulty difficulty, std::size_t historyLimit = MoveJournal::DEFAULT_CAPACITY);
 
     /**
      * @copydoc ISudokuGame::startNewGame()
@@ -106,6 +156,17 @@ public:
      */
     void startNewGame(Difficulty difficulty) override;
 
+    /**
+     * @brief Start a new game, giving up when stop is requested during generation.
+     *
+     * On cancellation the board is left half-generated, the timer is not
+     * started and no observer is notified; the game should be discarded.
+     *
+     * @param stop Token polled while the puzzle is generated.
+     * @return true when the game was started, false when it was cancelled.
+     */
+    bool startNewGame(const StopToken& stop);
+
     /**
      * @copydoc ISudokuGame::generatePuzzle()
      */
@@ -131,6 +192,11 @@ public:
      */
     CellState getCellState(int row, int col) const override;
 
+    /**
+     * @copydoc ISudokuGame::getBoardView()
+     */
+    BoardView getBoardView() const override { return board.View(); }
+
     /**
      * @copydoc ISudokuGame::isComplete()
      */
@@ -166,6 +232,26 @@ public:
      */
     void detachObserver(IObserver* observer) override;
 
+    /**
+     * @copydoc ISudokuGame::canUndo()
+     */
+    bool canUndo() const override;
+
+    /**
+     * @copydoc ISudokuGame::canRedo()
+     */
+    bool canRedo() const override;
+
+    /**
+     * @copydoc ISudokuGame::undo()
+     */
+    bool undo() override;
+
+    /**
+     * @copydoc ISudokuGame::redo()
+     */
+    bool redo() override;
+
     /**
      * @brief Get the solution value for a given cell from the stored solution.
      *
@@ -176,4 +262,86 @@ public:
      * @return Correct value for the cell (1-9) or 0 if position invalid.
      */
     int getSolutionValue(int row, int col) const;
+
+    /**
+     * @brief Serve new puzzles from a bank of graded seeds instead of generating them.
+     *
+     * The bank is not owned and must outlive the game. Pass nullptr to go back
+     * to full generation.
+     *
+     * @param bank Seed bank used by generatePuzzle() when it holds the current difficulty.
+     */
+    void setPuzzleBank(const PuzzleBank* bank);
+
+    /**
+     * @brief Encode the game into a binary save record.
+     *
+     * Takes no locks and does not allocate, so it is cheap enough to run after
+     * every move.
+     *
+     * @param out Receives the record; see GameSave for the layout.
+     */
+    void saveState(GameSave::Buffer& out) const;
+
+    /**
+     * @brief Restore a game from a record written by saveState().
+     *
+     * The puzzle comes from the record, so the generator is not run. The move
+     * history is cleared and the timer continues from the saved time unless the
+     * game is already over. Observers are notified as for a new game.
+     *
+     * @param in Record to decode.
+     * @return false if the record is corrupt or from another format version;
+     *         the game is left unchanged.
+     */
+    bool loadState(const GameSave::Buffer& in);
+
+    /**
+     * @brief Report every setValue, reset, undo and redo call to a session recorder.
+     *
+     * The recorder is not owned and must outlive the game or be detached by
+     * passing nullptr.
+     */
+    void setRecorder(SessionRecorder* sessionRecorder);
+
+    /**
+     * @brief Change how many moves can be undone, dropping the current history.
+     *
+     * The default keeps MoveJournal::DEFAULT_CAPACITY moves (128 KiB). This
+     * allocates a new history; pass the limit to the constructor instead when
+     * it is known up front.
+     *
+     * @param moves Number of moves kept, at least 1.
+     */
+    void setHistoryLimit(std::size_t moves);
+
+    /**
+     * @brief Publish a snapshot of the board for other threads after every change.
+     *
+     * The game itself stays single-threaded: only the owning thread may call
+     * its methods. Other threads read the returned publisher instead, which
+     * never blocks the game and never yields a half-updated board. The current
+     * state is published immediately; later calls return the same publisher.
+     *
+     * @return Publisher owned by the game and valid for its lifetime.
+     */
+    const BoardPublisher& enableSnapshotPublishing();
+
+    /**
+     * @brief Choose whether observers are called during a change or later from deliverEvents().
+     *
+     * In Queued mode a change only pushes a notification onto a lock-free
+     * queue, so mutating the game never runs observer code, whichever thread
+     * it happens on. Leaving Queued mode delivers what is pending.
+     */
+    void setDispatchMode(ObserverDispatcher::Mode mode);
+
+    /**
+     * @brief Call observers for the notifications queued since the last call.
+     *
+     * Must be called from a single thread, normally once per UI frame.
+     *
+     * @return Number of notifications delivered.
+     */
+    std::size_t deliverEvents();
 };
\ No newline at end of file
@@ -128,44 +128,29 @@
 
 
 #include "SudokuGenerator.h"
+#include "GridGenerator.h"
 #include "Random.h"
 #include <algorithm>
 #include <cstring>
 #include <vector>
 
 // Generate full board, save solution, then remove cells based on difficulty.
-void SudokuGenerator::Generate(SudokuBoard& board, Difficulty difficulty) {
+bool SudokuGenerator::Generate(SudokuBoard& board, Difficulty difficulty, const StopToken& stop) {
+    if (bank && bank->Derive(difficulty, board)) return true;
+
     board.Clear();
-    FillCell(board, 0);
+    FillBoard(board);
     SaveSolution(board);
-    RemoveCells(board, difficulty);
+    return RemoveCells(board, difficulty, stop);
 }
 
-bool SudokuGenerator::FillCell(SudokuBoard& board, int pos) {
-    if (pos == 81) return true;
-    int r = pos / 9, c = pos % 9;
-    std::vector<int> nums{ 1,2,3,4,5,6,7,8,9 };
-    auto& engine = Random::getEngine();
-    std::shuffle(nums.begin(), nums.end(), engine);
-    for (int n : nums) {
-        if (IsSafe(board, r, c, n)) {
-            board.Set(r, c, n);
-            if (FillCell(board, pos + 1)) return true;
-            board.Set(r, c, 0);
-        }
-    }
-    return false;
-}
-
-bool SudokuGenerator::IsSafe(const SudokuBoard& board, int row, int col, int num) const {
-    for (int x = 0; x < 9; ++x) {
-        if (board.Get(row, x) == num || board.Get(x, col) == num) return false;
-    }
-    int sr = row - row % 3, sc = col - col % 3;
-    for (int i = 0; i < 3; ++i)
-        for (int j = 0; j < 3; ++j)
-            if (board.Get(i + sr, j + sc) == num) return false;
-    return true;
+// Fill the whole board with a random complete grid.
+void SudokuGenerator::FillBoard(SudokuBoard& board) {
+    int grid[9][9];
+    GridGenerator(Random::getEngine()).Generate(grid);
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c)
+            board.Set(r, c, grid[r][c]);
 }
 
 void SudokuGenerator::SaveSolution(SudokuBoard& board) {
@@ -215,7 +200,7 @@ bool SudokuGenerator::HasUniqueSolution(const int test[9][9]) {
     return CountSolutions(test) == 1;
 }
 
-void SudokuGenerator::RemoveCells(SudokuBoard& board, Difficulty difficulty) {
+bool SudokuGenerator::RemoveCells(SudokuBoard& board, Difficulty difficulty, const StopToken& stop) {
     int cellsToRemove = 40;
     switch (difficulty) {
     case Difficulty::EASY: cellsToRemove = 30; break;
@@ -238,6 +223,8 @@ void SudokuGenerator::RemoveCells(SudokuBoard& board, Difficulty difficulty) {
     int removed = 0;
     for (const auto& p : cells) {
         if (removed >= cellsToRemove) break;
+        // Every removal runs a uniqueness check, the expensive part of generation.
+        if (stop.StopRequested()) return false;
         int r = p.first, c = p.second;
         if (board.Get(r, c) == 0) continue;
         int backup = board.Get(r, c);
@@ -258,4 +245,5 @@ void SudokuGenerator::RemoveCells(SudokuBoard& board, Difficulty difficulty) {
         for (int c = 0; c < 9; ++c)
             if (board.Get(r, c) != 0)
                 board.MarkInitial(r, c, true);
+    return true;
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #include "Difficulty.h"
 #include "SudokuBoard.h"
+#include "PuzzleBank.h"
+#include "CancellationToken.h"
 #include <vector>
 #include <random>
 #include <algorithm>
@@ -8,13 +10,20 @@
 
 class SudokuGenerator {
 public:
-    void Generate(SudokuBoard& board, Difficulty difficulty);
+    // Returns false (leaving board half-generated) when stop is requested
+    // before the puzzle is finished.
+    bool Generate(SudokuBoard& board, Difficulty difficulty, const StopToken& stop = StopToken());
+
+    // Optional bank of graded seeds; when it holds a seed for the requested
+    // difficulty, Generate derives from it instead of generating from scratch.
+    void SetPuzzleBank(const PuzzleBank* puzzleBank) { bank = puzzleBank; }
 
 private:
-    bool FillCell(SudokuBoard& board, int pos);
-    bool IsSafe(const SudokuBoard& board, int row, int col, int num) const;
+    const PuzzleBank* bank = nullptr;
+
+    void FillBoard(SudokuBoard& board);
     void SaveSolution(SudokuBoard& board);
-    void RemoveCells(SudokuBoard& board, Difficulty difficulty);
+    bool RemoveCells(SudokuBoard& board, Difficulty difficulty, const StopToken& stop);
 
     bool SolveSudoku(int grid[9][9], int pos, int& solutionCount, int limit);
     int CountSolutions(const int src[9][9]);
@@ -0,0 +1,70 @@
+#include "SudokuTransform.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+SudokuTransform SudokuTransform::Identity() {
+    SudokuTransform t;
+    for (int d = 0; d <= 9; ++d) t.digitMap[d] = d;
+    for (int i = 0; i < 9; ++i) {
+        t.rowMap[i] = i;
+        t.colMap[i] = i;
+    }
+    t.transpose = false;
+    return t;
+}
+
+// Fill map with a permutation of 0..8 that keeps groups of three together:
+// the groups are shuffled, then the three lines inside every group.
+static void RandomLinePermutation(int map[9], std::mt19937& engine) {
+    std::array<int, 3> groups{ 0, 1, 2 };
+    std::shuffle(groups.begin(), groups.end(), engine);
+    for (int g = 0; g < 3; ++g) {
+        std::array<int, 3> lines{ 0, 1, 2 };
+        std::shuffle(lines.begin(), lines.end(), engine);
+        for (int i = 0; i < 3; ++i) map[g * 3 + i] = groups[g] * 3 + lines[i];
+    }
+}
+
+SudokuTransform SudokuTransform::Random(std::mt19937& engine) {
+    SudokuTransform t;
+    RandomLinePermutation(t.rowMap, engine);
+    RandomLinePermutation(t.colMap, engine);
+
+    std::array<int, 9> digits{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    std::shuffle(digits.begin(), digits.end(), engine);
+    t.digitMap[0] = 0;
+    for (int d = 1; d <= 9; ++d) t.digitMap[d] = digits[d - 1];
+
+    t.transpose = (engine() & 1u) != 0;
+    return t;
+}
+
+void SudokuTransform::Apply(const int src[9][9], int dst[9][9]) const {
+    int tmp[81];
+    std::memcpy(tmp, src, sizeof(tmp));
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c)
+            dst[r][c] = digitMap[tmp[SourceIndex(r, c)]];
+}
+
+void SudokuTransform::Apply(const SudokuBoard& src, SudokuBoard& dst) const {
+    int values[9][9], solution[9][9];
+    bool initial[9][9];
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c) {
+            values[r][c] = src.Get(r, c);
+            solution[r][c] = src.GetSolution(r, c);
+            initial[r][c] = src.IsInitial(r, c);
+        }
+
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c) {
+            int s = SourceIndex(r, c);
+            dst.Set(r, c, digitMap[values[s / 9][s % 9]]);
+            dst.MarkInitial(r, c, initial[s / 9][s % 9]);
+        }
+
+    Apply(solution, solution);
+    dst.SetSolution(solution);
+}
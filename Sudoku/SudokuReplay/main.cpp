@@ -0,0 +1,94 @@
+// Replays recorded player sessions against the game logic, without any UI.
+//
+// Each .sdkr file (written by the game into sessions/) is re-executed from its
+// starting board as fast as possible. Calls whose result differs from the
+// recording are counted as mismatches, so the tool doubles as a regression
+// check and as a throughput benchmark for the game-logic layer.
+//
+// Usage: SudokuReplay [--no-hints] [--repeat N] [file or directory ...]
+// Without paths it replays the sessions directory.
+
+#include "../SudokuLib/SessionRecorder.h"
+#include "../SudokuLib/SessionReplayer.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+void collectLogs(const fs::path& path, std::vector<fs::path>& out) {
+    std::error_code ec;
+    if (fs::is_directory(path, ec)) {
+        for (const auto& entry : fs::recursive_directory_iterator(path, ec)) {
+            if (entry.is_regular_file(ec) && entry.path().extension() == ".sdkr") out.push_back(entry.path());
+        }
+    }
+    else if (fs::is_regular_file(path, ec)) {
+        out.push_back(path);
+    }
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    bool replayHints = true;
+    int repeat = 1;
+    bool pathsGiven = false;
+    std::vector<fs::path> files;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--no-hints") replayHints = false;
+        else if (arg == "--repeat" && i + 1 < argc) repeat = std::max(1, std::atoi(argv[++i]));
+        else {
+            collectLogs(arg, files);
+            pathsGiven = true;
+        }
+    }
+    if (!pathsGiven) collectLogs("sessions", files);
+    std::sort(files.begin(), files.end());
+
+    std::vector<SessionLog> logs;
+    logs.reserve(files.size());
+    for (const fs::path& file : files) {
+        SessionLog log;
+        if (log.Read(file.string())) logs.push_back(std::move(log));
+        else std::cerr << "Unreadable session: " << file.string() << "\n";
+    }
+    if (logs.empty()) {
+        std::cerr << "No sessions to replay\n";
+        return 1;
+    }
+
+    SessionReplayer replayer(replayHints);
+    SessionReplayer::Result total;
+    for (int pass = 0; pass < repeat; ++pass) {
+        for (std::size_t i = 0; i < logs.size(); ++i) {
+            std::size_t before = total.mismatches;
+            if (!replayer.Replay(logs[i], total)) {
+                std::cerr << "Corrupt starting board: " << files[i].string() << "\n";
+                continue;
+            }
+            if (pass == 0 && total.mismatches != before) {
+                std::cout << files[i].string() << ": " << total.mismatches - before << " mismatches\n";
+            }
+        }
+    }
+
+    double seconds = std::max(total.seconds, 1e-9);
+    std::cout << std::fixed << std::setprecision(1)
+        << total.sessions << " sessions, " << total.events << " events in "
+        << total.seconds * 1000.0 << " ms\n"
+        << total.sessions / seconds << " sessions/s, " << total.events / seconds << " events/s\n"
+        << total.mismatches << " mismatches";
+    if (total.skippedHints > 0) std::cout << ", " << total.skippedHints << " hints skipped";
+    std::cout << "\n";
+
+    return total.mismatches == 0 ? 0 : 2;
+}
@@ -0,0 +1,263 @@
+// Headless load test for the game library.
+//
+// Bot players play many SudokuGame instances to the end on several threads.
+// Each policy is run in turn and reports games/s, moves/s and the latency of
+// the calls the UI makes on every move: setValue, isValidMove and the hint
+// manager's next().
+//
+// Policies:
+//   solution  fill every empty cell with its solution value, checking each move first
+//   hints     ask the hint manager for every move and play what it suggests
+//   random    play random cells; with probability --mistakes a random digit,
+//             otherwise the right one, so some games are lost
+//
+// Usage: SudokuSim [--games N] [--threads T] [--policy solution|hints|random|all]
+//                  [--difficulty easy|medium|hard] [--mistakes P] [--seed S]
+
+#include "../SudokuLib/SudokuGame.h"
+#include "../SudokuLib/HintFactory.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum class Policy {
+    Solution,
+    Hints,
+    Random
+};
+
+const char* policyName(Policy policy) {
+    switch (policy) {
+    case Policy::Solution: return "solution";
+    case Policy::Hints: return "hints";
+    case Policy::Random: return "random";
+    }
+    return "?";
+}
+
+struct Options {
+    int games = 200;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<Policy> policies = { Policy::Solution, Policy::Hints, Policy::Random };
+    Difficulty difficulty = Difficulty::MEDIUM;
+    double mistakes = 0.05;
+    unsigned seed = 1;
+};
+
+// Call latencies in nanoseconds.
+struct Latencies {
+    std::vector<float> setValue;
+    std::vector<float> isValidMove;
+    std::vector<float> hintNext;
+};
+
+struct Totals {
+    int games = 0;
+    int won = 0;
+    int lost = 0;
+    long long moves = 0;
+    double generateSeconds = 0.0;
+    Latencies latency;
+};
+
+template <typename Call>
+auto timed(std::vector<float>& samples, Call&& call) {
+    auto start = Clock::now();
+    auto result = call();
+    samples.push_back(std::chrono::duration<float, std::nano>(Clock::now() - start).count());
+    return result;
+}
+
+void playSolution(SudokuGame& game, Totals& totals) {
+    for (int r = 0; r < 9; ++r) {
+        for (int c = 0; c < 9; ++c) {
+            if (game.getValue(r, c) != 0) continue;
+            int value = game.getSolutionValue(r, c);
+            if (!timed(totals.latency.isValidMove, [&] { return game.isValidMove(r, c, value); })) continue;
+            timed(totals.latency.setValue, [&] { return game.setValue(r, c, value); });
+            totals.moves++;
+        }
+    }
+}
+
+void playHints(SudokuGame& game, const IHintProvider& hints, Totals& totals) {
+    // Every move fills a cell, so 81 moves always end the game.
+    for (int move = 0; move < 81 && !game.isComplete() && game.getRemainingAttempts() > 0; ++move) {
+        std::optional<Hint> hint = timed(totals.latency.hintNext, [&] { return hints.next(game); });
+
+        int row = -1, col = -1, value = 0;
+        if (hint && hint->row >= 0 && hint->col >= 0 && game.getValue(hint->row, hint->col) == 0) {
+            row = hint->row;
+            col = hint->col;
+            value = hint->value;
+            // Candidate hints leave the choice to the player: try them in order.
+            for (std::size_t i = 0; value == 0 && i < hint->candidates.size(); ++i) {
+                int candidate = hint->candidates[i];
+                if (timed(totals.latency.isValidMove, [&] { return game.isValidMove(row, col, candidate); })) value = candidate;
+            }
+        }
+        // No usable hint: the bot falls back to the first empty cell's answer.
+        for (int cell = 0; value == 0 && cell < 81; ++cell) {
+            if (game.getValue(cell / 9, cell % 9) != 0) continue;
+            row = cell / 9;
+            col = cell % 9;
+            value = game.getSolutionValue(row, col);
+        }
+        if (value == 0) break;
+
+        timed(totals.latency.setValue, [&] { return game.setValue(row, col, value); });
+        totals.moves++;
+    }
+}
+
+void playRandom(SudokuGame& game, std::mt19937& rng, double mistakes, Totals& totals) {
+    std::bernoulli_distribution mistake(mistakes);
+    std::uniform_int_distribution<int> digit(1, 9);
+    int empty[81];
+
+    while (!game.isComplete() && game.getRemainingAttempts() > 0) {
+        int count = 0;
+        for (int cell = 0; cell < 81; ++cell)
+            if (game.getValue(cell / 9, cell % 9) == 0) empty[count++] = cell;
+        if (count == 0) break;
+
+        int cell = empty[std::uniform_int_distribution<int>(0, count - 1)(rng)];
+        int row = cell / 9, col = cell % 9;
+        int value = mistake(rng) ? digit(rng) : game.getSolutionValue(row, col);
+        timed(totals.latency.setValue, [&] { return game.setValue(row, col, value); });
+        totals.moves++;
+    }
+}
+
+void runWorker(const Options& options, Policy policy, int worker, std::atomic<int>& nextGame, Totals& totals) {
+    std::mt19937 rng(options.seed + worker);
+    auto hints = CreateHintManager(options.difficulty);
+
+    while (nextGame.fetch_add(1) < options.games) {
+        SudokuGame game(options.difficulty);
+        auto start = Clock::now();
+        game.startNewGame();
+        totals.generateSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+        switch (policy) {
+        case Policy::Solution: playSolution(game, totals); break;
+        case Policy::Hints: playHints(game, *hints, totals); break;
+        case Policy::Random: playRandom(game, rng, options.mistakes, totals); break;
+        }
+
+        totals.games++;
+        if (game.isComplete()) totals.won++;
+        else if (game.getRemainingAttempts() <= 0) totals.lost++;
+    }
+}
+
+void reportCalls(const std::string& name, std::vector<float>& samples) {
+    if (samples.empty()) return;
+
+    double sum = 0.0;
+    for (float s : samples) sum += s;
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double p) {
+        return samples[std::min(samples.size() - 1, static_cast<std::size_t>(p * samples.size()))];
+    };
+
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(0)
+        << std::setw(12) << samples.size()
+        << std::setw(10) << sum / samples.size()
+        << std::setw(10) << percentile(0.50)
+        << std::setw(10) << percentile(0.95)
+        << std::setw(10) << percentile(0.99)
+        << std::setw(12) << samples.back() << "\n";
+}
+
+void runPolicy(const Options& options, Policy policy) {
+    std::vector<Totals> perThread(options.threads);
+    std::atomic<int> nextGame{ 0 };
+
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.threads; ++t) {
+        workers.emplace_back(runWorker, std::cref(options), policy, t, std::ref(nextGame), std::ref(perThread[t]));
+    }
+    for (auto& w : workers) w.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    Totals total;
+    for (Totals& t : perThread) {
+        total.games += t.games;
+        total.won += t.won;
+        total.lost += t.lost;
+        total.moves += t.moves;
+        total.generateSeconds += t.generateSeconds;
+        auto append = [](std::vector<float>& to, const std::vector<float>& from) { to.insert(to.end(), from.begin(), from.end()); };
+        append(total.latency.setValue, t.latency.setValue);
+        append(total.latency.isValidMove, t.latency.isValidMove);
+        append(total.latency.hintNext, t.latency.hintNext);
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+        << policyName(policy) << ": " << total.games << " games (" << total.won << " won, " << total.lost << " lost), "
+        << total.moves << " moves in " << seconds * 1000.0 << " ms\n"
+        << "  " << total.games / seconds << " games/s, " << total.moves / seconds << " moves/s, "
+        << "generation " << total.generateSeconds * 1000.0 / std::max(1, total.games) << " ms/game\n";
+    std::cout << "  " << std::left << std::setw(14) << "call" << std::right
+        << std::setw(12) << "calls" << std::setw(10) << "mean ns" << std::setw(10) << "p50 ns"
+        << std::setw(10) << "p95 ns" << std::setw(10) << "p99 ns" << std::setw(12) << "max ns" << "\n";
+    reportCalls("setValue", total.latency.setValue);
+    reportCalls("isValidMove", total.latency.isValidMove);
+    reportCalls("hint next", total.latency.hintNext);
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value = i + 1 < argc ? argv[i + 1] : "";
+        if (arg == "--games" && !value.empty()) options.games = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && !value.empty()) options.threads = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--mistakes" && !value.empty()) options.mistakes = std::clamp(std::atof(argv[++i]), 0.0, 1.0);
+        else if (arg == "--seed" && !value.empty()) options.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--policy" && !value.empty()) {
+            ++i;
+            if (value == "solution") options.policies = { Policy::Solution };
+            else if (value == "hints") options.policies = { Policy::Hints };
+            else if (value == "random") options.policies = { Policy::Random };
+            else if (value != "all") return false;
+        }
+        else if (arg == "--difficulty" && !value.empty()) {
+            ++i;
+            if (value == "easy") options.difficulty = Difficulty::EASY;
+            else if (value == "medium") options.difficulty = Difficulty::MEDIUM;
+            else if (value == "hard") options.difficulty = Difficulty::HARD;
+            else return false;
+        }
+        else return false;
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "Usage: SudokuSim [--games N] [--threads T] [--policy solution|hints|random|all]\n"
+            << "                 [--difficulty easy|medium|hard] [--mistakes P] [--seed S]\n";
+        return 1;
+    }
+
+    std::cout << options.games << " games per policy on " << options.threads << " threads\n";
+    for (Policy policy : options.policies) runPolicy(options, policy);
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/AsyncHintService.h"
+#include "../SudokuLib/BoardSnapshot.h"
+#include "../SudokuLib/HintFactory.h"
+#include "../SudokuLib/HintPrecomputer.h"
+#include "../SudokuLib/SudokuGame.h"
+#include <atomic>
+#include <chrono>
+
+namespace {
+    // Provider that blocks until released, to control the worker's progress.
+    class GateProvider : public IHintProvider {
+    public:
+        mutable std::atomic<bool> open{ false };
+        mutable std::atomic<int> calls{ 0 };
+
+        std::optional<Hint> next(const ISudokuGame& game) const override {
+            calls++;
+            while (!open) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // Point at the first empty cell of the analysed board.
+            for (int r = 0; r < 9; r++)
+                for (int c = 0; c < 9; c++)
+                    if (game.getCellState(r, c) == CellState::EMPTY) {
+                        Hint h;
+                        h.row = r;
+                        h.col = c;
+                        return h;
+                    }
+            return std::nullopt;
+        }
+    };
+
+    bool WaitForPrecomputed(HintPrecomputer& precomputer, std::optional<Hint>& hint) {
+        for (int i = 0; i < 5000; i++) {
+            if (precomputer.current(hint)) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+}
+
+class AsyncHintTests : public ::testing::Test {
+protected:
+    SudokuGame game{ Difficulty::EASY };
+
+    void SetUp() override {
+        game.startNewGame();
+    }
+
+    bool FindEmptyCell(int& row, int& col) {
+        for (row = 0; row < 9; row++)
+            for (col = 0; col < 9; col++)
+                if (game.getCellState(row, col) == CellState::EMPTY) return true;
+        return false;
+    }
+};
+
+TEST_F(AsyncHintTests, SnapshotCopiesTheBoard) {
+    BoardSnapshot snapshot(game);
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            EXPECT_EQ(snapshot.getValue(r, c), game.getValue(r, c));
+            EXPECT_EQ(snapshot.getCellState(r, c), game.getCellState(r, c));
+        }
+    }
+    EXPECT_EQ(snapshot.getCurrentDifficulty(), Difficulty::EASY);
+    EXPECT_TRUE(snapshot.matches(game));
+}
+
+TEST_F(AsyncHintTests, SnapshotDetectsBoardChangesAndIgnoresWrites) {
+    BoardSnapshot snapshot(game);
+    int row, col;
+    ASSERT_TRUE(FindEmptyCell(row, col));
+
+    EXPECT_FALSE(snapshot.setValue(row, col, game.getSolutionValue(row, col)));
+    EXPECT_EQ(snapshot.getValue(row, col), 0);
+
+    game.setValue(row, col, game.getSolutionValue(row, col));
+    EXPECT_FALSE(snapshot.matches(game));
+}
+
+TEST_F(AsyncHintTests, RequestComputesHintForSnapshot) {
+    std::shared_ptr<const IHintProvider> provider = CreateHintManager(Difficulty::EASY);
+    AsyncHintService service;
+
+    auto future = service.request(provider, game);
+    AsyncHintService::Result result = future.get();
+
+    ASSERT_TRUE(result.board);
+    EXPECT_TRUE(result.board->matches(game));
+    ASSERT_TRUE(result.hint.has_value());
+    EXPECT_EQ(game.getCellState(result.hint->row, result.hint->col), CellState::EMPTY);
+}
+
+TEST_F(AsyncHintTests, QueuedRequestIsSupersededByNewerOne) {
+    auto provider = std::make_shared<GateProvider>();
+    AsyncHintService service;
+
+    auto running = service.request(provider, game);
+    while (provider->calls == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    auto superseded = service.request(provider, game);
+    auto latest = service.request(provider, game);
+
+    ASSERT_EQ(superseded.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_FALSE(superseded.get().hint.has_value());
+
+    provider->open = true;
+    EXPECT_TRUE(running.get().hint.has_value());
+    EXPECT_TRUE(latest.get().hint.has_value());
+    EXPECT_EQ(provider->calls, 2);
+}
+
+TEST_F(AsyncHintTests, PrecomputerHasHintForCurrentBoard) {
+    AsyncHintService service;
+    HintPrecomputer precomputer(game, CreateHintManager(Difficulty::EASY), service);
+
+    std::optional<Hint> hint;
+    ASSERT_TRUE(WaitForPrecomputed(precomputer, hint));
+    ASSERT_TRUE(hint.has_value());
+    EXPECT_EQ(game.getCellState(hint->row, hint->col), CellState::EMPTY);
+}
+
+TEST_F(AsyncHintTests, PrecomputerRecomputesAfterEachMove) {
+    AsyncHintService service;
+    HintPrecomputer precomputer(game, CreateHintManager(Difficulty::EASY), service);
+
+    for (int move = 0; move < 5; move++) {
+        std::optional<Hint> hint;
+        ASSERT_TRUE(WaitForPrecomputed(precomputer, hint));
+        ASSERT_TRUE(hint.has_value());
+        ASSERT_EQ(game.getCellState(hint->row, hint->col), CellState::EMPTY);
+        game.setValue(hint->row, hint->col, game.getSolutionValue(hint->row, hint->col));
+    }
+}
+
+TEST_F(AsyncHintTests, PrecomputerNeverReturnsHintForOlderBoard) {
+    auto provider = std::make_shared<GateProvider>();
+    AsyncHintService service;
+    HintPrecomputer precomputer(game, provider, service);
+    while (provider->calls == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // Fill the cell the in-flight computation is going to point at.
+    int row, col;
+    ASSERT_TRUE(FindEmptyCell(row, col));
+    game.setValue(row, col, game.getSolutionValue(row, col));
+
+    std::optional<Hint> hint;
+    EXPECT_FALSE(precomputer.current(hint));
+
+    provider->open = true;
+    ASSERT_TRUE(WaitForPrecomputed(precomputer, hint));
+    ASSERT_TRUE(hint.has_value());
+    EXPECT_FALSE(hint->row == row && hint->col == col);
+    EXPECT_EQ(provider->calls, 2);
+}
+
+TEST_F(AsyncHintTests, PrecomputerReadyDoesNotCollect) {
+    auto provider = std::make_shared<GateProvider>();
+    AsyncHintService service;
+    HintPrecomputer precomputer(game, provider, service);
+    while (provider->calls == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_FALSE(precomputer.ready());
+
+    provider->open = true;
+    for (int i = 0; i < 5000 && !precomputer.ready(); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_TRUE(precomputer.ready());
+    EXPECT_TRUE(precomputer.ready());
+
+    std::optional<Hint> hint;
+    EXPECT_TRUE(precomputer.current(hint));
+    EXPECT_TRUE(hint.has_value());
+    EXPECT_TRUE(precomputer.ready());
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/BoardPublisher.h"
+#include "../SudokuLib/HintFactory.h"
+#include "../SudokuLib/SudokuGame.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+class BoardPublisherTests : public ::testing::Test {
+protected:
+    SudokuGame game{ Difficulty::EASY };
+
+    void SetUp() override {
+        game.startNewGame();
+    }
+
+    std::vector<int> EmptyCells() const {
+        std::vector<int> cells;
+        for (int cell = 0; cell < 81; cell++)
+            if (game.getValue(cell / 9, cell % 9) == 0) cells.push_back(cell);
+        return cells;
+    }
+};
+
+TEST_F(BoardPublisherTests, ReadBeforePublishIsEmpty) {
+    BoardPublisher publisher;
+    BoardSnapshot board = publisher.Read();
+
+    EXPECT_EQ(publisher.Version(), 0u);
+    EXPECT_EQ(board.getValue(4, 4), 0);
+    EXPECT_EQ(board.getCellState(4, 4), CellState::EMPTY);
+}
+
+TEST_F(BoardPublisherTests, ReadReturnsPublishedState) {
+    BoardPublisher publisher;
+    publisher.Publish(game);
+    BoardSnapshot board = publisher.Read();
+
+    EXPECT_EQ(publisher.Version(), 1u);
+    EXPECT_TRUE(board.matches(game));
+    EXPECT_EQ(board.getRemainingAttempts(), game.getRemainingAttempts());
+    EXPECT_EQ(board.getCurrentDifficulty(), Difficulty::EASY);
+    EXPECT_FALSE(board.isComplete());
+}
+
+TEST_F(BoardPublisherTests, GamePublishesEveryChange) {
+    const BoardPublisher& publisher = game.enableSnapshotPublishing();
+    EXPECT_TRUE(publisher.Read().matches(game));
+
+    int cell = EmptyCells().front();
+    int row = cell / 9, col = cell % 9;
+    ASSERT_TRUE(game.setValue(row, col, game.getSolutionValue(row, col)));
+    EXPECT_EQ(publisher.Read().getValue(row, col), game.getSolutionValue(row, col));
+
+    int next = EmptyCells().front();
+    int wrong = game.getSolutionValue(next / 9, next % 9) % 9 + 1;
+    ASSERT_FALSE(game.setValue(next / 9, next % 9, wrong));
+    EXPECT_EQ(publisher.Read().getRemainingAttempts(), game.getRemainingAttempts());
+
+    game.undo();
+    EXPECT_EQ(publisher.Read().getValue(row, col), 0);
+
+    game.reset();
+    EXPECT_TRUE(publisher.Read().matches(game));
+    EXPECT_EQ(&game.enableSnapshotPublishing(), &publisher);
+}
+
+TEST_F(BoardPublisherTests, ConcurrentReadersNeverSeeTornBoards) {
+    const BoardPublisher& publisher = game.enableSnapshotPublishing();
+    const std::vector<int> order = EmptyCells();
+    ASSERT_FALSE(order.empty());
+
+    std::atomic<bool> done{ false };
+    std::atomic<int> torn{ 0 };
+    std::atomic<int> reads{ 0 };
+
+    // The writer fills the empty cells in order and clears them all at once,
+    // so every consistent board shows a filled prefix of order.
+    auto reader = [&] {
+        while (!done.load()) {
+            BoardSnapshot board = publisher.Read();
+            bool filling = true;
+            for (int cell : order) {
+                bool filled = board.getValue(cell / 9, cell % 9) != 0;
+                if (filled && !filling) torn++;
+                if (!filled) filling = false;
+            }
+            reads++;
+        }
+    };
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; i++) readers.emplace_back(reader);
+
+    for (int round = 0; round < 200; round++) {
+        for (int cell : order) game.setValue(cell / 9, cell % 9, game.getSolutionValue(cell / 9, cell % 9));
+        game.reset();
+        std::this_thread::yield();
+    }
+    done = true;
+    for (auto& t : readers) t.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_GT(reads.load(), 0);
+}
+
+TEST_F(BoardPublisherTests, HintsRunOnPublishedSnapshot) {
+    const BoardPublisher& publisher = game.enableSnapshotPublishing();
+    auto provider = CreateHintManager(Difficulty::EASY);
+
+    std::optional<Hint> hint;
+    std::thread worker([&] { hint = provider->next(publisher.Read()); });
+    worker.join();
+
+    ASSERT_TRUE(hint.has_value());
+    EXPECT_EQ(game.getValue(hint->row, hint->col), 0);
+}
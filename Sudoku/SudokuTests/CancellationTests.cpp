@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/CancellationToken.h"
+#include "../SudokuLib/AsyncGameCreator.h"
+#include "../SudokuLib/SudokuGenerator.h"
+#include "../SudokuLib/SudokuGame.h"
+#include <chrono>
+#include <thread>
+
+namespace {
+    std::unique_ptr<ISudokuGame> WaitForGame(AsyncGameCreator& creator) {
+        for (int i = 0; i < 10000; i++) {
+            if (auto game = creator.poll()) return game;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nullptr;
+    }
+
+    int CountFixed(const ISudokuGame& game) {
+        int fixed = 0;
+        for (int r = 0; r < 9; r++)
+            for (int c = 0; c < 9; c++)
+                if (game.getCellState(r, c) == CellState::FIXED) fixed++;
+        return fixed;
+    }
+}
+
+TEST(CancellationTests, DefaultTokenNeverStops) {
+    StopToken token;
+    EXPECT_FALSE(token.StopRequested());
+}
+
+TEST(CancellationTests, TokenSeesStopRequest) {
+    StopSource source;
+    StopToken token = source.GetToken();
+    EXPECT_FALSE(token.StopRequested());
+
+    source.RequestStop();
+    EXPECT_TRUE(token.StopRequested());
+    EXPECT_TRUE(source.StopRequested());
+}
+
+TEST(CancellationTests, GeneratorStopsWhenRequested) {
+    StopSource source;
+    source.RequestStop();
+
+    SudokuGenerator generator;
+    SudokuBoard board;
+    EXPECT_FALSE(generator.Generate(board, Difficulty::HARD, source.GetToken()));
+    EXPECT_TRUE(generator.Generate(board, Difficulty::HARD));
+}
+
+TEST(CancellationTests, CancelledGameIsNotStarted) {
+    StopSource source;
+    source.RequestStop();
+
+    SudokuGame game(Difficulty::MEDIUM);
+    EXPECT_FALSE(game.startNewGame(source.GetToken()));
+}
+
+TEST(CancellationTests, CreatorHandsOverStartedGame) {
+    AsyncGameCreator creator;
+    creator.start(Difficulty::EASY);
+    EXPECT_TRUE(creator.busy());
+
+    auto game = WaitForGame(creator);
+    ASSERT_TRUE(game);
+    EXPECT_FALSE(creator.busy());
+    EXPECT_EQ(game->getCurrentDifficulty(), Difficulty::EASY);
+    EXPECT_GT(CountFixed(*game), 0);
+    EXPECT_EQ(game->getRemainingAttempts(), 3);
+}
+
+TEST(CancellationTests, RestartingReplacesThePreviousCreation) {
+    AsyncGameCreator creator;
+    creator.start(Difficulty::HARD);
+    creator.start(Difficulty::EASY);
+
+    auto game = WaitForGame(creator);
+    ASSERT_TRUE(game);
+    EXPECT_EQ(game->getCurrentDifficulty(), Difficulty::EASY);
+    EXPECT_EQ(creator.poll(), nullptr);
+}
+
+TEST(CancellationTests, CancelledCreationIsNeverHandedOver) {
+    AsyncGameCreator creator;
+    creator.start(Difficulty::MEDIUM);
+    creator.cancel();
+
+    EXPECT_FALSE(creator.busy());
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(creator.poll(), nullptr);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/SudokuCanonical.h"
+#include "../SudokuLib/SudokuGenerator.h"
+
+class SudokuCanonicalTests : public ::testing::Test {
+protected:
+    SudokuBoard puzzle;
+    int givens[9][9];
+    int solution[9][9];
+    std::mt19937 engine{ 2024u };
+
+    void SetUp() override {
+        SudokuGenerator generator;
+        generator.Generate(puzzle, Difficulty::HARD);
+        puzzle.CopyTo(givens);
+        for (int i = 0; i < 9; i++)
+            for (int j = 0; j < 9; j++)
+                solution[i][j] = puzzle.GetSolution(i, j);
+    }
+
+    static bool LessOrEqual(const int a[9][9], const int b[9][9]) {
+        for (int i = 0; i < 9; i++)
+            for (int j = 0; j < 9; j++)
+                if (a[i][j] != b[i][j]) return a[i][j] < b[i][j];
+        return true;
+    }
+};
+
+TEST_F(SudokuCanonicalTests, EquivalentPuzzlesShareCanonicalForm) {
+    int expected[9][9];
+    SudokuCanonical::Canonicalize(givens, expected);
+
+    for (int n = 0; n < 20; n++) {
+        int transformed[9][9], canonical[9][9];
+        SudokuTransform::Random(engine).Apply(givens, transformed);
+        SudokuCanonical::Canonicalize(transformed, canonical);
+
+        for (int i = 0; i < 9; i++)
+            for (int j = 0; j < 9; j++)
+                EXPECT_EQ(canonical[i][j], expected[i][j]);
+    }
+}
+
+TEST_F(SudokuCanonicalTests, EquivalentSolutionsShareHash) {
+    std::uint64_t expected = SudokuCanonical::Hash(solution);
+    for (int n = 0; n < 20; n++) {
+        int transformed[9][9];
+        SudokuTransform::Random(engine).Apply(solution, transformed);
+        EXPECT_EQ(SudokuCanonical::Hash(transformed), expected);
+    }
+}
+
+TEST_F(SudokuCanonicalTests, CanonicalFormIsMinimalAndStable) {
+    int canonical[9][9], again[9][9];
+    SudokuCanonical::Canonicalize(givens, canonical);
+    SudokuCanonical::Canonicalize(canonical, again);
+
+    EXPECT_TRUE(LessOrEqual(canonical, givens));
+    for (int i = 0; i < 9; i++)
+        for (int j = 0; j < 9; j++)
+            EXPECT_EQ(again[i][j], canonical[i][j]);
+}
+
+TEST_F(SudokuCanonicalTests, BoardHashIgnoresPlayerMoves) {
+    std::uint64_t before = SudokuCanonical::Hash(puzzle);
+
+    for (int i = 0; i < 9; i++)
+        for (int j = 0; j < 9; j++)
+            if (!puzzle.IsInitial(i, j)) puzzle.Set(i, j, puzzle.GetSolution(i, j));
+
+    EXPECT_EQ(SudokuCanonical::Hash(puzzle), before);
+    EXPECT_EQ(before, SudokuCanonical::Hash(givens));
+}
+
+TEST_F(SudokuCanonicalTests, DifferentPuzzlesHashDifferently) {
+    int fewer[9][9];
+    std::copy(&givens[0][0], &givens[0][0] + 81, &fewer[0][0]);
+    for (int i = 0; i < 81; i++) {
+        if (fewer[i / 9][i % 9] != 0) {
+            fewer[i / 9][i % 9] = 0;
+            break;
+        }
+    }
+    EXPECT_NE(SudokuCanonical::Hash(fewer), SudokuCanonical::Hash(givens));
+}
+
+TEST_F(SudokuCanonicalTests, SparseGridsShareCanonicalForm) {
+    // Mostly empty grids have many identical rows and columns.
+    for (int keep : { 1, 3, 8 }) {
+        int sparse[9][9] = {};
+        for (int n = 0; n < keep; n++) {
+            int cell = (n * 31) % 81;
+            sparse[cell / 9][cell % 9] = solution[cell / 9][cell % 9];
+        }
+
+        int expected[9][9];
+        SudokuCanonical::Canonicalize(sparse, expected);
+        for (int n = 0; n < 10; n++) {
+            int transformed[9][9], canonical[9][9];
+            SudokuTransform::Random(engine).Apply(sparse, transformed);
+            SudokuCanonical::Canonicalize(transformed, canonical);
+            for (int i = 0; i < 9; i++)
+                for (int j = 0; j < 9; j++)
+                    EXPECT_EQ(canonical[i][j], expected[i][j]);
+        }
+        EXPECT_TRUE(LessOrEqual(expected, sparse));
+    }
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/CellMask.h"
+#include "../SudokuLib/HintContext.h"
+#include "../SudokuLib/SudokuBoard.h"
+#include "../SudokuLib/SudokuGame.h"
+#include <algorithm>
+#include <vector>
+
+TEST(CellMaskTests, SetResetAndCountAcrossBothWords) {
+    CellMask mask;
+    EXPECT_FALSE(mask.Any());
+
+    mask.Set(0);
+    mask.Set(63);
+    mask.Set(64);
+    mask.Set(80);
+    EXPECT_EQ(mask.Count(), 4);
+    EXPECT_TRUE(mask.Test(63));
+    EXPECT_TRUE(mask.Test(64));
+    EXPECT_FALSE(mask.Test(40));
+
+    mask.Reset(63);
+    EXPECT_FALSE(mask.Test(63));
+    EXPECT_EQ(mask.Count(), 3);
+    EXPECT_EQ(CellMask::All().Count(), 81);
+}
+
+TEST(CellMaskTests, ForEachVisitsSetCellsInOrder) {
+    CellMask mask;
+    for (int cell : { 80, 5, 64, 33, 63 }) mask.Set(cell);
+
+    std::vector<int> visited;
+    mask.ForEach([&](int cell) { visited.push_back(cell); });
+    EXPECT_EQ(visited, (std::vector<int>{ 5, 33, 63, 64, 80 }));
+}
+
+TEST(CellMaskTests, UnitsAndPeers) {
+    for (int i = 0; i < 9; i++) {
+        EXPECT_EQ(CellMask::Row(i).Count(), 9);
+        EXPECT_EQ(CellMask::Column(i).Count(), 9);
+        EXPECT_EQ(CellMask::Box(i).Count(), 9);
+    }
+    EXPECT_TRUE(CellMask::Row(8).Test(80));
+    EXPECT_TRUE(CellMask::Column(4).Test(7 * 9 + 4));
+    EXPECT_TRUE(CellMask::Box(4).Test(4 * 9 + 5));
+    EXPECT_FALSE(CellMask::Box(4).Test(2 * 9 + 5));
+
+    // 8 in the row, 8 in the column and 4 more in the box, plus the cell itself.
+    CellMask peers = CellMask::Peers(40);
+    EXPECT_EQ(peers.Count(), 21);
+    EXPECT_TRUE(peers.Test(40));
+    EXPECT_FALSE(peers.Test(0));
+}
+
+TEST(CellMaskTests, BoardTracksCellsPerDigit) {
+    SudokuBoard board;
+    EXPECT_EQ(board.CellsWith(0), CellMask::All());
+
+    board.Set(0, 0, 7);
+    board.Set(8, 8, 7);
+    board.Set(4, 4, 3);
+    EXPECT_EQ(board.CellsWith(7).Count(), 2);
+    EXPECT_TRUE(board.CellsWith(7).Test(80));
+    EXPECT_EQ(board.CellsWith(0).Count(), 78);
+
+    board.Set(8, 8, 3);
+    EXPECT_EQ(board.CellsWith(7).Count(), 1);
+    EXPECT_EQ(board.CellsWith(3).Count(), 2);
+
+    board.Set(4, 4, 0);
+    EXPECT_FALSE(board.CellsWith(3).Test(40));
+    EXPECT_TRUE(board.CellsWith(0).Test(40));
+
+    board.Clear();
+    EXPECT_EQ(board.CellsWith(0), CellMask::All());
+    EXPECT_FALSE(board.CellsWith(3).Any());
+}
+
+TEST(CellMaskTests, ViewMasksMatchValues) {
+    SudokuGame game(Difficulty::MEDIUM);
+    game.startNewGame();
+    const BoardView board = game.getBoardView();
+
+    for (int cell = 0; cell < 81; cell++) {
+        int value = board.Value(cell / 9, cell % 9);
+        for (int digit = 0; digit <= 9; digit++) {
+            EXPECT_EQ(board.Cells(digit).Test(cell), digit == value);
+        }
+    }
+}
+
+TEST(CellMaskTests, CandidateCellsMatchCandidateLists) {
+    SudokuGame game(Difficulty::HARD);
+    game.startNewGame();
+    HintContext ctx(game, false);
+
+    for (int cell = 0; cell < 81; cell++) {
+        const auto& candidates = ctx.candidatesAt(cell / 9, cell % 9);
+        for (int n = 1; n <= 9; n++) {
+            bool listed = std::find(candidates.begin(), candidates.end(), n) != candidates.end();
+            EXPECT_EQ(ctx.candidateCells[n].Test(cell), listed);
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../SudokuLib/GameSave.h"
+#include "../SudokuLib/GameAutoSaver.h"
+#include "../SudokuLib/SudokuGame.h"
+#include "MockObserver.h"
+#include <chrono>
+#include <thread>
+
+class GameSaveTests : public ::testing::Test {
+protected:
+    SudokuGame game{ Difficulty::HARD };
+    const std::string path = "test_savegame.bin";
+
+    void SetUp() override {
+        game.startNewGame();
+        GameSave::Remove(path);
+    }
+
+    void TearDown() override {
+        GameSave::Remove(path);
+    }
+
+    int FindEmptyCell() const {
+        for (int cell = 0; cell < 81; cell++)
+            if (game.getValue(cell / 9, cell % 9) == 0) return cell;
+        return -1;
+    }
+
+    static void SetElapsed(GameSave::Buffer& buffer, std::uint32_t seconds) {
+        for (int i = 0; i < 4; i++) buffer[7 + i] = static_cast<std::uint8_t>(seconds >> (8 * i));
+        std::uint32_t sum = GameSave::Checksum(buffer);
+        for (int i = 0; i < 4; i++) buffer[GameSave::SIZE - 4 + i] = static_cast<std::uint8_t>(sum >> (8 * i));
+    }
+
+    static void ExpectSameGame(const SudokuGame& a, const SudokuGame& b) {
+        EXPECT_EQ(a.getCurrentDifficulty(), b.getCurrentDifficulty());
+        EXPECT_EQ(a.getRemainingAttempts(), b.getRemainingAttempts());
+        for (int r = 0; r < 9; r++) {
+            for (int c = 0; c < 9; c++) {
+                EXPECT_EQ(a.getValue(r, c), b.getValue(r, c));
+                EXPECT_EQ(a.getSolutionValue(r, c), b.getSolutionValue(r, c));
+                EXPECT_EQ(a.getCellState(r, c), b.getCellState(r, c));
+            }
+        }
+    }
+};
+
+TEST_F(GameSaveTests, LoadRestoresSavedGame) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+    game.setValue(row, col, game.getSolutionValue(row, col));
+    int other = FindEmptyCell();
+    game.setValue(other / 9, other % 9, game.getSolutionValue(other / 9, other % 9) % 9 + 1);
+
+    GameSave::Buffer buffer;
+    game.saveState(buffer);
+
+    SudokuGame restored(Difficulty::EASY);
+    ASSERT_TRUE(restored.loadState(buffer));
+    ExpectSameGame(game, restored);
+    EXPECT_FALSE(restored.canUndo());
+}
+
+TEST_F(GameSaveTests, LoadContinuesTimerFromSavedTime) {
+    GameSave::Buffer buffer;
+    game.saveState(buffer);
+    SetElapsed(buffer, 754);
+
+    SudokuGame restored;
+    ASSERT_TRUE(restored.loadState(buffer));
+    EXPECT_GE(restored.getElapsedTime(), 754);
+    EXPECT_LE(restored.getElapsedTime(), 755);
+}
+
+TEST_F(GameSaveTests, CorruptRecordIsRejected) {
+    GameSave::Buffer buffer;
+    game.saveState(buffer);
+    buffer[20] ^= 0x01;
+
+    SudokuGame other(Difficulty::EASY);
+    other.startNewGame();
+    GameSave::Buffer before;
+    other.saveState(before);
+
+    EXPECT_FALSE(other.loadState(buffer));
+    GameSave::Buffer after;
+    other.saveState(after);
+    EXPECT_EQ(before, after);
+}
+
+TEST_F(GameSaveTests, WrongVersionIsRejected) {
+    GameSave::Buffer buffer;
+    game.saveState(buffer);
+    buffer[4] = GameSave::VERSION + 1;
+    SetElapsed(buffer, 0);
+
+    SudokuGame restored;
+    EXPECT_FALSE(restored.loadState(buffer));
+}
+
+TEST_F(GameSaveTests, LoadNotifiesObservers) {
+    GameSave::Buffer buffer;
+    game.saveState(buffer);
+
+    SudokuGame restored;
+    MockObserver observer;
+    restored.attachObserver(&observer);
+    EXPECT_CALL(observer, onBoardChanged()).Times(1);
+    EXPECT_CALL(observer, onAttemptsChanged(3)).Times(1);
+    EXPECT_TRUE(restored.loadState(buffer));
+    restored.detachObserver(&observer);
+}
+
+TEST_F(GameSaveTests, FileRoundTrip) {
+    GameSave::Buffer buffer;
+    game.saveState(buffer);
+    ASSERT_TRUE(GameSave::Write(path, buffer));
+    EXPECT_TRUE(GameSave::Exists(path));
+
+    GameSave::Buffer read;
+    ASSERT_TRUE(GameSave::Read(path, read));
+    EXPECT_EQ(buffer, read);
+
+    GameSave::Remove(path);
+    EXPECT_FALSE(GameSave::Exists(path));
+    EXPECT_FALSE(GameSave::Read(path, read));
+}
+
+TEST_F(GameSaveTests, AutoSaverTracksEveryMove) {
+    GameAutoSaver saver(game, path);
+    ASSERT_TRUE(GameSave::Exists(path));
+
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    game.setValue(cell / 9, cell % 9, game.getSolutionValue(cell / 9, cell % 9));
+
+    GameSave::Buffer buffer;
+    ASSERT_TRUE(GameSave::Read(path, buffer));
+    SudokuGame restored;
+    ASSERT_TRUE(restored.loadState(buffer));
+    ExpectSameGame(game, restored);
+}
+
+TEST_F(GameSaveTests, AutoSaverRemovesSaveWhenGameIsLost) {
+    GameAutoSaver saver(game, path);
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int wrong = game.getSolutionValue(cell / 9, cell % 9) % 9 + 1;
+    for (int i = 0; i < 3; i++) game.setValue(cell / 9, cell % 9, wrong);
+
+    EXPECT_FALSE(GameSave::Exists(path));
+
+    game.reset();
+    EXPECT_TRUE(GameSave::Exists(path));
+}
+
+TEST_F(GameSaveTests, AutoSaverRemovesSaveWhenGameIsWon) {
+    GameAutoSaver saver(game, path);
+    for (int r = 0; r < 9; r++)
+        for (int c = 0; c < 9; c++)
+            if (game.getValue(r, c) == 0) game.setValue(r, c, game.getSolutionValue(r, c));
+
+    ASSERT_TRUE(game.isComplete());
+    EXPECT_FALSE(GameSave::Exists(path));
+}
+
+TEST_F(GameSaveTests, AutoSaverKeepsIdleTimeWhenDestroyed) {
+    int idle;
+    {
+        GameAutoSaver saver(game, path);
+        int cell = FindEmptyCell();
+        ASSERT_GE(cell, 0);
+        game.setValue(cell / 9, cell % 9, game.getSolutionValue(cell / 9, cell % 9));
+
+        // Sit on the board without moving until the timer ticks over.
+        const int lastMove = game.getElapsedTime();
+        while (game.getElapsedTime() == lastMove) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        idle = game.getElapsedTime();
+    }
+
+    GameSave::Buffer buffer;
+    ASSERT_TRUE(GameSave::Read(path, buffer));
+    SudokuGame restored;
+    ASSERT_TRUE(restored.loadState(buffer));
+    EXPECT_GE(restored.getElapsedTime(), idle);
+    ExpectSameGame(game, restored);
+}
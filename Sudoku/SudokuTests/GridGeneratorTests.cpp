@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/GridGenerator.h"
+
+class GridGeneratorTests : public ::testing::Test {
+protected:
+    std::mt19937 engine{ 7u };
+    int grid[9][9];
+
+    bool IsCompleteAndValid() const {
+        for (int i = 0; i < 9; i++) {
+            bool row[10] = { false }, col[10] = { false }, box[10] = { false };
+            for (int j = 0; j < 9; j++) {
+                int rv = grid[i][j];
+                int cv = grid[j][i];
+                int bv = grid[(i / 3) * 3 + j / 3][(i % 3) * 3 + j % 3];
+                if (rv < 1 || rv > 9 || row[rv]) return false;
+                if (cv < 1 || cv > 9 || col[cv]) return false;
+                if (bv < 1 || bv > 9 || box[bv]) return false;
+                row[rv] = col[cv] = box[bv] = true;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(GridGeneratorTests, GeneratesValidCompleteGrids) {
+    GridGenerator generator(engine);
+    for (int n = 0; n < 500; n++) {
+        generator.Generate(grid);
+        ASSERT_TRUE(IsCompleteAndValid());
+    }
+}
+
+TEST_F(GridGeneratorTests, SameSeedGivesSameGrid) {
+    std::mt19937 other{ 7u };
+    int first[9][9];
+    GridGenerator(engine).Generate(first);
+    GridGenerator(other).Generate(grid);
+
+    for (int i = 0; i < 9; i++)
+        for (int j = 0; j < 9; j++)
+            EXPECT_EQ(grid[i][j], first[i][j]);
+}
+
+TEST_F(GridGeneratorTests, EveryDigitAppearsInEveryCell) {
+    GridGenerator generator(engine);
+    bool seen[81][10] = { { false } };
+    for (int n = 0; n < 2000; n++) {
+        generator.Generate(grid);
+        for (int i = 0; i < 81; i++) seen[i][grid[i / 9][i % 9]] = true;
+    }
+
+    for (int i = 0; i < 81; i++)
+        for (int d = 1; d <= 9; d++)
+            EXPECT_TRUE(seen[i][d]) << "cell " << i << " never got " << d;
+}
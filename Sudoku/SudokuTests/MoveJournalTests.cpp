@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "../SudokuLib/MoveJournal.h"
+#include "../SudokuLib/PerfStats.h"
+#include "../SudokuLib/SudokuGame.h"
+#include "MockObserver.h"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Exactly;
+
+class MoveJournalTests : public ::testing::Test {
+protected:
+    SudokuGame game{ Difficulty::EASY };
+
+    void SetUp() override {
+        game.startNewGame();
+    }
+
+    // First empty cell, as row * 9 + col.
+    int FindEmptyCell() const {
+        for (int cell = 0; cell < 81; cell++)
+            if (game.getValue(cell / 9, cell % 9) == 0) return cell;
+        return -1;
+    }
+
+    int WrongValue(int row, int col) const {
+        return game.getSolutionValue(row, col) % 9 + 1;
+    }
+};
+
+TEST_F(MoveJournalTests, PackRoundTripsEveryField) {
+    for (int cell : { 0, 40, 80 }) {
+        for (int oldValue = 0; oldValue <= 9; oldValue++) {
+            for (int newValue = 0; newValue <= 9; newValue++) {
+                for (bool consumed : { false, true }) {
+                    MoveJournal::Move move = MoveJournal::Unpack(
+                        MoveJournal::Pack({ cell, oldValue, newValue, consumed }));
+                    EXPECT_EQ(move.cell, cell);
+                    EXPECT_EQ(move.oldValue, oldValue);
+                    EXPECT_EQ(move.newValue, newValue);
+                    EXPECT_EQ(move.attemptConsumed, consumed);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(MoveJournalTests, FullRingKeepsNewestMoves) {
+    MoveJournal journal(4);
+    for (int i = 0; i < 10; i++) journal.Record({ i, 0, i % 9 + 1, false });
+
+    EXPECT_EQ(journal.UndoCount(), 4u);
+    for (int i = 9; i >= 6; i--) {
+        ASSERT_TRUE(journal.CanUndo());
+        EXPECT_EQ(journal.Undo().cell, i);
+    }
+    EXPECT_FALSE(journal.CanUndo());
+    EXPECT_EQ(journal.RedoCount(), 4u);
+}
+
+TEST_F(MoveJournalTests, RecordDropsRedoHistory) {
+    MoveJournal journal(8);
+    journal.Record({ 1, 0, 1, false });
+    journal.Record({ 2, 0, 2, false });
+    journal.Undo();
+    ASSERT_TRUE(journal.CanRedo());
+
+    journal.Record({ 3, 0, 3, false });
+    EXPECT_FALSE(journal.CanRedo());
+    EXPECT_EQ(journal.Undo().cell, 3);
+    EXPECT_EQ(journal.Undo().cell, 1);
+}
+
+TEST_F(MoveJournalTests, UndoRedoRestoresCellValue) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+    int answer = game.getSolutionValue(row, col);
+
+    ASSERT_TRUE(game.setValue(row, col, answer));
+    ASSERT_TRUE(game.canUndo());
+
+    EXPECT_TRUE(game.undo());
+    EXPECT_EQ(game.getValue(row, col), 0);
+    EXPECT_FALSE(game.canUndo());
+    EXPECT_TRUE(game.canRedo());
+
+    EXPECT_TRUE(game.redo());
+    EXPECT_EQ(game.getValue(row, col), answer);
+    EXPECT_FALSE(game.canRedo());
+}
+
+TEST_F(MoveJournalTests, RejectedMoveIsNotUndoable) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+
+    ASSERT_FALSE(game.setValue(row, col, WrongValue(row, col)));
+    ASSERT_EQ(game.getRemainingAttempts(), 2);
+
+    EXPECT_FALSE(game.canUndo());
+    EXPECT_FALSE(game.undo());
+    EXPECT_EQ(game.getRemainingAttempts(), 2);
+    EXPECT_EQ(game.getValue(row, col), 0);
+}
+
+TEST_F(MoveJournalTests, UndoRedoStepOverRejectedMoves) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+    int answer = game.getSolutionValue(row, col);
+
+    ASSERT_TRUE(game.setValue(row, col, answer));
+    ASSERT_FALSE(game.setValue(row, col, WrongValue(row, col)));
+    ASSERT_EQ(game.getRemainingAttempts(), 2);
+
+    EXPECT_TRUE(game.undo());
+    EXPECT_EQ(game.getValue(row, col), 0);
+    EXPECT_EQ(game.getRemainingAttempts(), 2);
+    EXPECT_FALSE(game.canUndo());
+
+    EXPECT_TRUE(game.redo());
+    EXPECT_EQ(game.getValue(row, col), answer);
+    EXPECT_EQ(game.getRemainingAttempts(), 2);
+    EXPECT_FALSE(game.canRedo());
+}
+
+TEST_F(MoveJournalTests, UndoCannotAvoidLosing) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+    int answer = game.getSolutionValue(row, col);
+
+    ASSERT_TRUE(game.setValue(row, col, answer));
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(game.setValue(row, col, 0));
+        ASSERT_FALSE(game.setValue(row, col, WrongValue(row, col)));
+        ASSERT_TRUE(game.undo());
+    }
+    ASSERT_EQ(game.getRemainingAttempts(), 1);
+
+    game.setValue(row, col, WrongValue(row, col));
+    EXPECT_EQ(game.getRemainingAttempts(), 0);
+    EXPECT_FALSE(game.canUndo());
+}
+
+TEST_F(MoveJournalTests, UndoNotifiesObservers) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+
+    game.setValue(row, col, game.getSolutionValue(row, col));
+    game.setValue(row, col, 0);
+    game.setValue(row, col, WrongValue(row, col));
+
+    MockObserver observer;
+    game.attachObserver(&observer);
+    EXPECT_CALL(observer, onAttemptsChanged(_)).Times(0);
+    EXPECT_CALL(observer, onBoardChanged()).Times(Exactly(2));
+    EXPECT_CALL(observer, onGameComplete()).Times(0);
+
+    // The rejected move is stepped over; only the clear and the entry are undone.
+    EXPECT_TRUE(game.undo());
+    EXPECT_TRUE(game.undo());
+    EXPECT_FALSE(game.undo());
+    game.detachObserver(&observer);
+}
+
+TEST_F(MoveJournalTests, NoUndoAfterGameIsLost) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+
+    for (int i = 0; i < 3; i++) game.setValue(row, col, WrongValue(row, col));
+    ASSERT_EQ(game.getRemainingAttempts(), 0);
+
+    EXPECT_FALSE(game.canUndo());
+    EXPECT_FALSE(game.undo());
+    EXPECT_EQ(game.getRemainingAttempts(), 0);
+}
+
+TEST_F(MoveJournalTests, ResetClearsHistory) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    game.setValue(cell / 9, cell % 9, game.getSolutionValue(cell / 9, cell % 9));
+
+    game.reset();
+    EXPECT_FALSE(game.canUndo());
+    EXPECT_FALSE(game.canRedo());
+}
+
+TEST_F(MoveJournalTests, LongSessionUndoesLatestMoves) {
+    int cell = FindEmptyCell();
+    ASSERT_GE(cell, 0);
+    int row = cell / 9, col = cell % 9;
+    int answer = game.getSolutionValue(row, col);
+
+    // Alternate between the answer and a clear far past the journal capacity.
+    const int moves = 300000;
+    for (int i = 0; i < moves; i++) {
+        ASSERT_TRUE(game.setValue(row, col, i % 2 == 0 ? answer : 0));
+    }
+    EXPECT_EQ(game.getValue(row, col), 0);
+
+    int undone = 0;
+    while (game.undo()) undone++;
+    EXPECT_EQ(undone, static_cast<int>(MoveJournal::DEFAULT_CAPACITY));
+    EXPECT_EQ(game.getValue(row, col), 0);
+}
+
+TEST_F(MoveJournalTests, FirstMoveOnFreshGameDoesNotAllocate) {
+    SudokuGame fresh(Difficulty::EASY, 128);
+    fresh.startNewGame();
+    int cell = 0;
+    while (fresh.getValue(cell / 9, cell % 9) != 0) cell++;
+
+    const auto before = PerfStats::AllocationCount();
+    fresh.setValue(cell / 9, cell % 9, fresh.getSolutionValue(cell / 9, cell % 9));
+    EXPECT_EQ(PerfStats::AllocationCount(), before);
+    EXPECT_TRUE(fresh.canUndo());
+}
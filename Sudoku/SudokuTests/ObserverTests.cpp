@@ -2,6 +2,10 @@
 #include <gmock/gmock.h>
 #include "../SudokuLib/SudokuGame.h"
 #include "MockObserver.h"
+#include "../SudokuLib/MpscQueue.h"
+#include "../SudokuLib/PerfStats.h"
+#include <thread>
+#include <vector>
 
 using ::testing::_;
 using ::testing::AtLeast;
@@ -271,4 +275,142 @@ TEST_F(ObserverPatternTests, MultipleOperationsMultipleNotifications) {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_F(ObserverPatternTests, QueuedModeDefersNotificationsUntilDelivered) {
+    game->attachObserver(mockObserver1);
+    game->setDispatchMode(ObserverDispatcher::Mode::Queued);
+
+    EXPECT_CALL(*mockObserver1, onBoardChanged()).Times(0);
+    EXPECT_CALL(*mockObserver1, onAttemptsChanged(_)).Times(0);
+    game->startNewGame();
+    ::testing::Mock::VerifyAndClearExpectations(mockObserver1);
+
+    using ::testing::InSequence;
+    {
+        InSequence seq;
+        EXPECT_CALL(*mockObserver1, onBoardChanged()).Times(1);
+        EXPECT_CALL(*mockObserver1, onAttemptsChanged(3)).Times(1);
+    }
+    EXPECT_EQ(game->deliverEvents(), 2u);
+    EXPECT_EQ(game->deliverEvents(), 0u);
+}
+
+TEST_F(ObserverPatternTests, LeavingQueuedModeDeliversPendingNotifications) {
+    game->attachObserver(mockObserver1);
+    game->startNewGame();
+    game->setDispatchMode(ObserverDispatcher::Mode::Queued);
+    game->reset();
+
+    EXPECT_CALL(*mockObserver1, onBoardChanged()).Times(1);
+    EXPECT_CALL(*mockObserver1, onAttemptsChanged(3)).Times(1);
+    game->setDispatchMode(ObserverDispatcher::Mode::Immediate);
+}
+
+TEST_F(ObserverPatternTests, QueueOverflowFoldsNotifications) {
+    game->startNewGame();
+    game->attachObserver(mockObserver1);
+    game->setDispatchMode(ObserverDispatcher::Mode::Queued);
+
+    for (std::size_t i = 0; i < ObserverDispatcher::QUEUE_CAPACITY + 10; i++) game->reset();
+
+    EXPECT_CALL(*mockObserver1, onBoardChanged()).Times(ObserverDispatcher::QUEUE_CAPACITY / 2 + 1);
+    EXPECT_CALL(*mockObserver1, onAttemptsChanged(3)).Times(ObserverDispatcher::QUEUE_CAPACITY / 2 + 1);
+    game->deliverEvents();
+}
+
+namespace {
+    // Detaches itself and attaches another observer from inside a callback.
+    class SwappingObserver : public IObserver {
+    public:
+        SudokuGame& game;
+        IObserver* replacement;
+        int calls = 0;
+
+        SwappingObserver(SudokuGame& game, IObserver* replacement) : game(game), replacement(replacement) {}
+
+        void onBoardChanged() override {
+            calls++;
+            game.detachObserver(this);
+            game.attachObserver(replacement);
+        }
+        void onGameComplete() override {}
+        void onAttemptsChanged(int) override {}
+    };
+}
+
+TEST_F(ObserverPatternTests, ObserversMayDetachAndAttachDuringDispatch) {
+    game->startNewGame();
+    SwappingObserver swapping(*game, mockObserver1);
+    game->attachObserver(&swapping);
+
+    // The replacement joins with the next notification, not the current one.
+    EXPECT_CALL(*mockObserver1, onBoardChanged()).Times(1);
+    EXPECT_CALL(*mockObserver1, onAttemptsChanged(3)).Times(2);
+    game->reset();
+    game->reset();
+
+    EXPECT_EQ(swapping.calls, 1);
+}
+
+TEST_F(ObserverPatternTests, DispatchIsOnlyTimedWithObservers) {
+    const PerfChannel& dispatches = PerfStats::Channel("observers");
+    game->startNewGame();
+
+    const auto before = dispatches.Count();
+    game->reset();
+    EXPECT_EQ(dispatches.Count(), before);
+
+    EXPECT_CALL(*mockObserver1, onBoardChanged()).Times(1);
+    EXPECT_CALL(*mockObserver1, onAttemptsChanged(3)).Times(1);
+    game->attachObserver(mockObserver1);
+    game->reset();
+    EXPECT_EQ(dispatches.Count(), before + 2);
+
+    // Detaching the last observer makes notifications free again.
+    game->detachObserver(mockObserver1);
+    game->reset();
+    EXPECT_EQ(dispatches.Count(), before + 2);
+}
+
+TEST(MpscQueueTests, PopsInPushOrderAndRejectsWhenFull) {
+    MpscQueue<int> queue(4);
+    for (int i = 0; i < 4; i++) EXPECT_TRUE(queue.TryPush(i));
+    EXPECT_FALSE(queue.TryPush(4));
+
+    int value = -1;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(MpscQueueTests, ManyProducersLoseNothing) {
+    MpscQueue<int> queue(64);
+    const int producers = 4, perProducer = 5000;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&queue, p] {
+            for (int i = 0; i < perProducer; i++)
+                while (!queue.TryPush(p * perProducer + i)) std::this_thread::yield();
+        });
+    }
+
+    std::vector<int> last(producers, -1);
+    int received = 0, value;
+    while (received < producers * perProducer) {
+        if (!queue.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int producer = value / perProducer;
+        // Values from one producer arrive in the order they were pushed.
+        EXPECT_GT(value, last[producer]);
+        last[producer] = value;
+        received++;
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_FALSE(queue.TryPop(value));
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/PerfStats.h"
+#include "../SudokuLib/HintFactory.h"
+#include "../SudokuLib/SudokuGame.h"
+
+TEST(PerfStatsTests, EmptyChannelHasNoSamples) {
+    PerfChannel channel;
+    std::array<float, PerfChannel::CAPACITY> samples;
+    EXPECT_EQ(channel.Count(), 0u);
+    EXPECT_EQ(channel.Last(), 0.f);
+    EXPECT_EQ(channel.Snapshot(samples), 0u);
+}
+
+TEST(PerfStatsTests, SnapshotReturnsSamplesOldestFirst) {
+    PerfChannel channel;
+    for (int i = 1; i <= 5; i++) channel.Record(static_cast<float>(i));
+
+    std::array<float, PerfChannel::CAPACITY> samples;
+    ASSERT_EQ(channel.Snapshot(samples), 5u);
+    for (int i = 0; i < 5; i++) EXPECT_EQ(samples[i], static_cast<float>(i + 1));
+    EXPECT_EQ(channel.Last(), 5.f);
+}
+
+TEST(PerfStatsTests, RingKeepsOnlyTheMostRecentSamples) {
+    PerfChannel channel;
+    const int total = static_cast<int>(PerfChannel::CAPACITY) + 10;
+    for (int i = 0; i < total; i++) channel.Record(static_cast<float>(i));
+
+    std::array<float, PerfChannel::CAPACITY> samples;
+    ASSERT_EQ(channel.Snapshot(samples), PerfChannel::CAPACITY);
+    EXPECT_EQ(channel.Count(), static_cast<std::uint64_t>(total));
+    EXPECT_EQ(samples.front(), 10.f);
+    EXPECT_EQ(samples.back(), static_cast<float>(total - 1));
+}
+
+TEST(PerfStatsTests, ChannelLookupReturnsTheSameInstance) {
+    PerfChannel& a = PerfStats::Channel("test.lookup");
+    PerfChannel& b = PerfStats::Channel("test.lookup");
+    EXPECT_EQ(&a, &b);
+
+    bool listed = false;
+    for (const auto& channel : PerfStats::Channels()) {
+        if (channel.first == "test.lookup") listed = channel.second == &a;
+    }
+    EXPECT_TRUE(listed);
+}
+
+TEST(PerfStatsTests, ScopedTimerRecordsOneSample) {
+    PerfChannel channel;
+    {
+        PerfStats::ScopedTimer timer(channel);
+    }
+    EXPECT_EQ(channel.Count(), 1u);
+    EXPECT_GE(channel.Last(), 0.f);
+}
+
+TEST(PerfStatsTests, GameAndHintsRecordTimings) {
+    std::uint64_t generated = PerfStats::Channel("generate").Count();
+    std::uint64_t hints = PerfStats::Channel("hint").Count();
+
+    SudokuGame game(Difficulty::EASY);
+    game.startNewGame();
+    auto provider = CreateHintManager(Difficulty::EASY);
+    provider->next(game);
+
+    EXPECT_EQ(PerfStats::Channel("generate").Count(), generated + 1);
+    EXPECT_EQ(PerfStats::Channel("hint").Count(), hints + 1);
+    EXPECT_GT(PerfStats::Channel("hint.NakedSingle").Count(), 0u);
+}
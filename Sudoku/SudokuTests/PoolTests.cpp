@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/ObjectPool.h"
+#include "../SudokuLib/HintContext.h"
+#include "../SudokuLib/HintFactory.h"
+#include "../SudokuLib/PerfStats.h"
+#include "../SudokuLib/SessionHost.h"
+#include "../SudokuLib/SudokuGame.h"
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    struct Tracked {
+        static int live;
+        int value;
+        explicit Tracked(int v) : value(v) {
+            if (v < 0) throw std::invalid_argument("negative");
+            live++;
+        }
+        ~Tracked() { live--; }
+    };
+    int Tracked::live = 0;
+}
+
+TEST(ObjectPoolTests, CreateConstructsAndPtrDestroys) {
+    ObjectPool<Tracked> pool(4);
+    {
+        auto a = pool.Create(7);
+        EXPECT_EQ(a->value, 7);
+        EXPECT_EQ(Tracked::live, 1);
+        EXPECT_EQ(pool.InUse(), 1u);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+    EXPECT_EQ(pool.InUse(), 0u);
+}
+
+TEST(ObjectPoolTests, FreedSlotsAreReused) {
+    ObjectPool<Tracked> pool(4);
+    auto a = pool.Create(1);
+    Tracked* address = a.get();
+    a.reset();
+
+    auto b = pool.Create(2);
+    EXPECT_EQ(b.get(), address);
+    EXPECT_EQ(pool.Capacity(), 4u);
+}
+
+TEST(ObjectPoolTests, GrowsByWholeChunks) {
+    ObjectPool<Tracked> pool(4);
+    std::vector<ObjectPool<Tracked>::Ptr> objects;
+    for (int i = 0; i < 5; i++) objects.push_back(pool.Create(i));
+
+    EXPECT_EQ(pool.Capacity(), 8u);
+    EXPECT_EQ(pool.InUse(), 5u);
+
+    objects.clear();
+    for (int i = 0; i < 8; i++) objects.push_back(pool.Create(i));
+    EXPECT_EQ(pool.Capacity(), 8u);
+}
+
+TEST(ObjectPoolTests, ThrowingConstructorReturnsSlot) {
+    ObjectPool<Tracked> pool(1);
+    EXPECT_THROW(pool.Create(-1), std::invalid_argument);
+    EXPECT_EQ(pool.InUse(), 0u);
+
+    auto a = pool.Create(3);
+    EXPECT_EQ(pool.Capacity(), 1u);
+}
+
+TEST(ObjectPoolTests, PooledGamesArePlayable) {
+    ObjectPool<SudokuGame> pool(2);
+    auto game = pool.Create(Difficulty::EASY);
+    game->startNewGame();
+    EXPECT_EQ(game->getCurrentDifficulty(), Difficulty::EASY);
+    EXPECT_FALSE(game->isComplete());
+}
+
+TEST(ObjectPoolTests, PooledGameAllocatesOnlyItsHistory) {
+    ObjectPool<SudokuGame> pool(2);
+    auto cycle = [&] { pool.Create(Difficulty::EASY, SessionHost::HISTORY_LIMIT); };
+    cycle();  // Grows the pool.
+
+    // The slot is reused; the history ring is the game's only allocation.
+    const auto before = PerfStats::AllocationCount();
+    cycle();
+    EXPECT_EQ(PerfStats::AllocationCount() - before, 1u);
+}
+
+TEST(HintArenaTests, ContextFitsInHintManagerArena) {
+    SudokuGame game(Difficulty::HARD);
+    game.startNewGame();
+
+    // An arena without upstream throws bad_alloc as soon as the buffer runs out.
+    alignas(std::max_align_t) std::byte buffer[16 * 1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    HintContext ctx(game, false, &arena);
+
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            if (game.getValue(r, c) == 0) {
+                EXPECT_FALSE(ctx.candidatesAt(r, c).empty());
+            }
+            else {
+                EXPECT_TRUE(ctx.candidatesAt(r, c).empty());
+            }
+        }
+    }
+}
+
+TEST(HintArenaTests, RepeatedHintsStayAvailable) {
+    SudokuGame game(Difficulty::MEDIUM);
+    game.startNewGame();
+    auto provider = CreateHintManager(Difficulty::MEDIUM);
+
+    for (int i = 0; i < 100; i++) {
+        auto hint = provider->next(game);
+        ASSERT_TRUE(hint.has_value());
+        EXPECT_GE(hint->row, 0);
+        EXPECT_LT(hint->row, 9);
+    }
+}
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/ScoreManager.h"
+#include "../SudokuLib/PerfStats.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Every test runs in its own empty working directory, since ScoreManager
+// reads and writes its files relative to it.
+class ScoreManagerTests : public ::testing::Test {
+protected:
+    fs::path previous;
+    fs::path dir;
+
+    void SetUp() override {
+        previous = fs::current_path();
+        dir = fs::temp_directory_path() /
+            ("sudoku_scores_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        fs::remove_all(dir);
+        fs::create_directories(dir);
+        fs::current_path(dir);
+
+        // Sync the cache with the empty directory before the test touches any file.
+        ScoreManager::getScoreCount("Easy");
+    }
+
+    void TearDown() override {
+        ScoreManager::compact();
+        fs::current_path(previous);
+        fs::remove_all(dir);
+    }
+
+    static void WriteFile(const std::string& path, const std::string& content) {
+        std::ofstream out(path, std::ios::trunc);
+        out << content;
+    }
+
+    static std::vector<std::string> ReadLines(const std::string& path) {
+        std::ifstream in(path);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(in, line);) lines.push_back(line);
+        return lines;
+    }
+
+    static bool Contains(const std::vector<std::string>& lines, const std::string& line) {
+        return std::find(lines.begin(), lines.end(), line) != lines.end();
+    }
+};
+
+TEST_F(ScoreManagerTests, OutsideEditIsPickedUp) {
+    WriteFile("leaderboard.txt", "alice,Easy,100\n");
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 1);
+
+    WriteFile("leaderboard.txt", "alice,Easy,100\nbob,Easy,90\n");
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 2);
+    ASSERT_FALSE(ScoreManager::getTopScores("Easy").empty());
+    EXPECT_EQ(ScoreManager::getTopScores("Easy").front().first, "bob");
+}
+
+TEST_F(ScoreManagerTests, OwnAppendDoesNotReload) {
+    const PerfChannel& loads = PerfStats::Channel("leaderboard.load");
+    WriteFile("leaderboard.txt", "alice,Easy,100\n");
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 1);
+    const auto before = loads.Count();
+
+    ScoreManager::updateOrAddScore("bob", "Easy", 80);
+    ScoreManager::updateOrAddScore("alice", "Easy", 70);
+
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 2);
+    EXPECT_EQ(ScoreManager::getRank("alice", "Easy"), 1);
+    EXPECT_EQ(loads.Count(), before);
+}
+
+TEST_F(ScoreManagerTests, CompactFoldsLogIntoSnapshot) {
+    WriteFile("leaderboard.txt", "alice,Easy,100\n");
+    ScoreManager::updateOrAddScore("bob", "Easy", 90);
+    ScoreManager::updateOrAddScore("alice", "Easy", 80);
+    ScoreManager::updateOrAddScore("alice", "Hard", 300);
+    ASSERT_TRUE(fs::exists("leaderboard.log"));
+
+    ScoreManager::compact();
+
+    EXPECT_FALSE(fs::exists("leaderboard.log"));
+    EXPECT_FALSE(fs::exists("leaderboard.log.compacting"));
+    auto snapshot = ReadLines("leaderboard.txt");
+    EXPECT_EQ(snapshot.size(), 3u);
+    EXPECT_TRUE(Contains(snapshot, "alice,Easy,80"));
+    EXPECT_TRUE(Contains(snapshot, "bob,Easy,90"));
+    EXPECT_TRUE(Contains(snapshot, "alice,Hard,300"));
+
+    // The files changed under the cache, so this reloads from the new snapshot.
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 2);
+    EXPECT_EQ(ScoreManager::getRank("alice", "Easy"), 1);
+    EXPECT_EQ(ScoreManager::getScoreCount("Hard"), 1);
+}
+
+TEST_F(ScoreManagerTests, LeftoverCompactingFileIsFolded) {
+    // State left by a compaction interrupted after moving the log aside.
+    WriteFile("leaderboard.txt", "alice,Easy,100\n");
+    WriteFile("leaderboard.log.compacting", "bob,Easy,90\nalice,Easy,95\n");
+    WriteFile("leaderboard.log", "carol,Easy,80\n");
+
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 3);
+    EXPECT_EQ(ScoreManager::getRank("alice", "Easy"), 3);
+
+    ScoreManager::compact();
+    EXPECT_FALSE(fs::exists("leaderboard.log.compacting"));
+    auto snapshot = ReadLines("leaderboard.txt");
+    EXPECT_TRUE(Contains(snapshot, "alice,Easy,95"));
+    EXPECT_TRUE(Contains(snapshot, "bob,Easy,90"));
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 3);
+
+    // The live log is left for the next compaction.
+    ScoreManager::compact();
+    EXPECT_FALSE(fs::exists("leaderboard.log"));
+    EXPECT_TRUE(Contains(ReadLines("leaderboard.txt"), "carol,Easy,80"));
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 3);
+}
+
+TEST_F(ScoreManagerTests, RecordsAppendedDuringCompactionAreKept) {
+    // The 512th record starts a background compaction; the rest are appended
+    // while it may still be running.
+    const int total = 800;
+    for (int i = 0; i < total; i++) {
+        ScoreManager::updateOrAddScore("user" + std::to_string(i), "Medium", 100 + i);
+    }
+
+    ScoreManager::compact();
+
+    EXPECT_FALSE(fs::exists("leaderboard.log"));
+    EXPECT_FALSE(fs::exists("leaderboard.log.compacting"));
+    auto snapshot = ReadLines("leaderboard.txt");
+    EXPECT_EQ(snapshot.size(), static_cast<size_t>(total));
+    EXPECT_TRUE(Contains(snapshot, "user799,Medium,899"));
+    EXPECT_EQ(ScoreManager::getScoreCount("Medium"), total);
+    EXPECT_EQ(ScoreManager::getRank("user511", "Medium"), 512);
+}
+
+TEST_F(ScoreManagerTests, TiesShareARank) {
+    ScoreManager::updateOrAddScore("alice", "Easy", 100);
+    ScoreManager::updateOrAddScore("bob", "Easy", 100);
+    ScoreManager::updateOrAddScore("carol", "Easy", 120);
+    ScoreManager::updateOrAddScore("dave", "Easy", 90);
+
+    EXPECT_EQ(ScoreManager::getRank("dave", "Easy"), 1);
+    EXPECT_EQ(ScoreManager::getRank("alice", "Easy"), 2);
+    EXPECT_EQ(ScoreManager::getRank("bob", "Easy"), 2);
+    EXPECT_EQ(ScoreManager::getRank("carol", "Easy"), 4);
+    EXPECT_EQ(ScoreManager::getRank("erin", "Easy"), 0);
+    EXPECT_EQ(ScoreManager::getRank("alice", "Hard"), 0);
+}
+
+TEST_F(ScoreManagerTests, TopScoresKeepsTheBestTen) {
+    for (int i = 0; i < 15; i++) {
+        ScoreManager::updateOrAddScore("user" + std::to_string(i), "Medium", 300 - i * 10);
+    }
+
+    const auto& top = ScoreManager::getTopScores("Medium");
+    ASSERT_EQ(top.size(), 10u);
+    EXPECT_EQ(top.front(), std::make_pair(std::string("user14"), 160));
+    EXPECT_EQ(top.back(), std::make_pair(std::string("user5"), 250));
+    EXPECT_EQ(ScoreManager::getScoreCount("Medium"), 15);
+    EXPECT_EQ(ScoreManager::getRank("user0", "Medium"), 15);
+    EXPECT_TRUE(ScoreManager::getTopScores("Hard").empty());
+}
+
+TEST_F(ScoreManagerTests, ImprovedTimeMovesUserUp) {
+    for (int i = 0; i < 12; i++) {
+        ScoreManager::updateOrAddScore("user" + std::to_string(i), "Hard", 500 + i);
+    }
+    EXPECT_EQ(ScoreManager::getRank("user11", "Hard"), 12);
+
+    // A slower time does not replace the best one.
+    ScoreManager::updateOrAddScore("user11", "Hard", 600);
+    EXPECT_EQ(ScoreManager::getRank("user11", "Hard"), 12);
+
+    ScoreManager::updateOrAddScore("user11", "Hard", 400);
+    EXPECT_EQ(ScoreManager::getRank("user11", "Hard"), 1);
+    EXPECT_EQ(ScoreManager::getRank("user0", "Hard"), 2);
+    EXPECT_EQ(ScoreManager::getScoreCount("Hard"), 12);
+
+    const auto& top = ScoreManager::getTopScores("Hard");
+    ASSERT_EQ(top.size(), 10u);
+    EXPECT_EQ(top.front(), std::make_pair(std::string("user11"), 400));
+    EXPECT_EQ(top.back().first, "user8");
+}
+
+TEST_F(ScoreManagerTests, SlowTimesAreRankedTogether) {
+    const int maxRanked = 99 * 60 + 59;
+    ScoreManager::updateOrAddScore("alice", "Easy", maxRanked - 1);
+    ScoreManager::updateOrAddScore("bob", "Easy", maxRanked);
+    ScoreManager::updateOrAddScore("carol", "Easy", maxRanked + 500);
+
+    EXPECT_EQ(ScoreManager::getRank("alice", "Easy"), 1);
+    EXPECT_EQ(ScoreManager::getRank("bob", "Easy"), 2);
+    EXPECT_EQ(ScoreManager::getRank("carol", "Easy"), 2);
+
+    // The top list still orders by the real times.
+    const auto& top = ScoreManager::getTopScores("Easy");
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top.back(), std::make_pair(std::string("carol"), maxRanked + 500));
+}
+
+TEST_F(ScoreManagerTests, BadRecordsAreSkipped) {
+    WriteFile("leaderboard.txt", "alice,Easy,100\nbob,Easy,-3\ncarol,Easy\ndave,Easy,abc\n");
+    WriteFile("leaderboard.log", "erin,Easy,-1\nfrank,Easy,90\n");
+
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 2);
+    EXPECT_EQ(ScoreManager::getRank("bob", "Easy"), 0);
+    EXPECT_EQ(ScoreManager::getRank("frank", "Easy"), 1);
+
+    ScoreManager::updateOrAddScore("gina", "Easy", -5);
+    EXPECT_EQ(ScoreManager::getRank("gina", "Easy"), 0);
+    EXPECT_EQ(ScoreManager::getScoreCount("Easy"), 2);
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/SessionHost.h"
+#include "../SudokuLib/SessionProtocol.h"
+#include "../SudokuLib/PuzzleBank.h"
+#include "../SudokuLib/SudokuGenerator.h"
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+class SessionHostTests : public ::testing::Test {
+protected:
+    PuzzleBank bank;
+
+    void SetUp() override {
+        SudokuGenerator generator;
+        for (Difficulty d : { Difficulty::EASY, Difficulty::MEDIUM, Difficulty::HARD }) {
+            SudokuBoard seed;
+            generator.Generate(seed, d);
+            bank.Add(d, seed);
+        }
+    }
+
+    // First empty cell of a session, as row * 9 + col.
+    static int FindEmptyCell(SessionHost& host, SessionHost::SessionId id) {
+        for (int cell = 0; cell < 81; cell++) {
+            int value = -1;
+            if (host.getValue(id, cell / 9, cell % 9, value) && value == 0) return cell;
+        }
+        return -1;
+    }
+};
+
+TEST_F(SessionHostTests, SessionsGetDistinctIds) {
+    SessionHost host(8, &bank);
+    std::set<SessionHost::SessionId> ids;
+    for (int i = 0; i < 100; i++) ids.insert(host.createSession(Difficulty::EASY));
+
+    EXPECT_EQ(ids.size(), 100u);
+    EXPECT_EQ(ids.count(0), 0u);
+    EXPECT_EQ(host.sessionCount(), 100u);
+}
+
+TEST_F(SessionHostTests, UnknownSessionIsReported) {
+    SessionHost host(4, &bank);
+    bool accepted = false;
+    int value = 0;
+    std::optional<Hint> hint;
+
+    EXPECT_FALSE(host.setValue(42, 0, 0, 1, accepted));
+    EXPECT_FALSE(host.getValue(42, 0, 0, value));
+    EXPECT_FALSE(host.hint(42, hint));
+    EXPECT_FALSE(host.startNewGame(42, Difficulty::EASY));
+    EXPECT_FALSE(host.endSession(42));
+}
+
+TEST_F(SessionHostTests, MovesOnlyAffectTheirSession) {
+    SessionHost host(4, &bank);
+    SessionHost::SessionId a = host.createSession(Difficulty::EASY);
+    SessionHost::SessionId b = host.createSession(Difficulty::EASY);
+
+    int cell = FindEmptyCell(host, a);
+    ASSERT_GE(cell, 0);
+    int before = -1;
+    ASSERT_TRUE(host.getValue(b, cell / 9, cell % 9, before));
+
+    // Try every digit; exactly one is the answer.
+    int accepted = 0;
+    for (int v = 1; v <= 9; v++) {
+        bool ok = false;
+        ASSERT_TRUE(host.setValue(a, cell / 9, cell % 9, v, ok));
+        if (ok) {
+            accepted++;
+            break;
+        }
+    }
+    EXPECT_EQ(accepted, 1);
+
+    int after = -1;
+    ASSERT_TRUE(host.getValue(b, cell / 9, cell % 9, after));
+    EXPECT_EQ(after, before);
+}
+
+TEST_F(SessionHostTests, EndSessionFreesIt) {
+    SessionHost host(4, &bank);
+    SessionHost::SessionId id = host.createSession(Difficulty::MEDIUM);
+    EXPECT_TRUE(host.endSession(id));
+    EXPECT_EQ(host.sessionCount(), 0u);
+
+    int value = 0;
+    EXPECT_FALSE(host.getValue(id, 0, 0, value));
+}
+
+TEST_F(SessionHostTests, HintPointsAtEmptyCell) {
+    SessionHost host(4, &bank);
+    SessionHost::SessionId id = host.createSession(Difficulty::EASY);
+
+    std::optional<Hint> hint;
+    ASSERT_TRUE(host.hint(id, hint));
+    ASSERT_TRUE(hint.has_value());
+    int value = -1;
+    ASSERT_TRUE(host.getValue(id, hint->row, hint->col, value));
+    EXPECT_EQ(value, 0);
+}
+
+TEST_F(SessionHostTests, ConcurrentRequestsOnManySessions) {
+    SessionHost host(16, &bank);
+    const int threads = 4;
+    const int sessionsPerThread = 250;
+    std::vector<std::vector<SessionHost::SessionId>> ids(threads);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < sessionsPerThread; i++) {
+                SessionHost::SessionId id = host.createSession(static_cast<Difficulty>(i % 3));
+                ids[t].push_back(id);
+                for (int v = 1; v <= 9; v++) {
+                    bool accepted = false;
+                    host.setValue(id, 4, 4, v, accepted);
+                    if (accepted) break;
+                }
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    EXPECT_EQ(host.sessionCount(), static_cast<std::size_t>(threads * sessionsPerThread));
+    for (const auto& list : ids) {
+        for (SessionHost::SessionId id : list) {
+            int value = 0;
+            ASSERT_TRUE(host.getValue(id, 4, 4, value));
+            EXPECT_GE(value, 1);
+        }
+    }
+}
+
+TEST_F(SessionHostTests, ProtocolRoundTrip) {
+    SessionHost host(4, &bank);
+    SessionProtocol protocol(host);
+
+    std::string created = protocol.handle("NEW easy");
+    ASSERT_EQ(created.rfind("OK ", 0), 0u);
+    std::string id = created.substr(3);
+
+    EXPECT_EQ(protocol.handle("GET " + id + " 0 0").rfind("OK ", 0), 0u);
+    EXPECT_EQ(protocol.handle("SET " + id + " 0 0 10"), "OK REJECTED");
+    EXPECT_EQ(protocol.handle("HINT " + id).rfind("OK ", 0), 0u);
+    EXPECT_EQ(protocol.handle("START " + id + " hard"), "OK");
+    EXPECT_EQ(protocol.handle("END " + id), "OK");
+    EXPECT_EQ(protocol.handle("END " + id), "ERR unknown session");
+}
+
+TEST_F(SessionHostTests, ProtocolHintCarriesTypeAndCandidates) {
+    SessionHost host(4, &bank);
+    SessionProtocol protocol(host);
+    SessionHost::SessionId id = host.createSession(Difficulty::EASY);
+    const std::set<std::string> types = {
+        "naked_single", "hidden_single", "candidate_list", "safe_cell", "local_reasoning"
+    };
+
+    // Providers pick among equally good hints at random, so check the shape of several.
+    for (int i = 0; i < 20; i++) {
+        std::istringstream response(protocol.handle("HINT " + std::to_string(id)));
+        std::string ok, type;
+        int row, col, value;
+        ASSERT_TRUE(response >> ok >> type >> row >> col >> value);
+        EXPECT_EQ(ok, "OK");
+        EXPECT_EQ(types.count(type), 1u) << type;
+        EXPECT_TRUE(row >= 0 && row < 9 && col >= 0 && col < 9);
+        EXPECT_TRUE(value >= 0 && value <= 9);
+
+        int empty = -1;
+        ASSERT_TRUE(host.getValue(id, row, col, empty));
+        EXPECT_EQ(empty, 0);
+
+        std::vector<int> candidates;
+        for (int candidate; response >> candidate;) candidates.push_back(candidate);
+        EXPECT_TRUE(response.eof());
+        for (int candidate : candidates) EXPECT_TRUE(candidate >= 1 && candidate <= 9);
+        if (type == "candidate_list") EXPECT_FALSE(candidates.empty());
+    }
+}
+
+TEST_F(SessionHostTests, ProtocolRejectsMalformedRequests) {
+    SessionHost host(4, &bank);
+    SessionProtocol protocol(host);
+
+    EXPECT_EQ(protocol.handle(""), "ERR unknown command");
+    EXPECT_EQ(protocol.handle("JUMP 1"), "ERR unknown command");
+    EXPECT_EQ(protocol.handle("NEW impossible"), "ERR bad request");
+    EXPECT_EQ(protocol.handle("SET 1 0"), "ERR bad request");
+    EXPECT_EQ(protocol.handle("GET x 0 0"), "ERR bad request");
+    EXPECT_EQ(protocol.handle("END 1 2"), "ERR bad request");
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/SessionRecorder.h"
+#include "../SudokuLib/SessionReplayer.h"
+#include "../SudokuLib/HintFactory.h"
+#include "../SudokuLib/SudokuGame.h"
+#include "../SudokuLib/GameSave.h"
+#include <algorithm>
+#include <filesystem>
+
+class SessionReplayTests : public ::testing::Test {
+protected:
+    SudokuGame game{ Difficulty::EASY };
+    SessionRecorder recorder;
+    const std::string path = "test_session.sdkr";
+
+    void SetUp() override {
+        game.startNewGame();
+        recorder.Begin(game);
+        game.setRecorder(&recorder);
+    }
+
+    void TearDown() override {
+        GameSave::Remove(path);
+    }
+
+    // A short session mixing accepted and rejected moves, undo/redo, a hint and a reset.
+    void PlaySession() {
+        auto hints = CreateHintManager(Difficulty::EASY);
+        int played = 0;
+        for (int cell = 0; cell < 81 && played < 10; cell++) {
+            int r = cell / 9, c = cell % 9;
+            if (game.getValue(r, c) != 0) continue;
+            if (played == 3) game.setValue(r, c, game.getSolutionValue(r, c) % 9 + 1);
+            game.setValue(r, c, game.getSolutionValue(r, c));
+            played++;
+        }
+        game.undo();
+        game.undo();
+        game.redo();
+        recorder.RecordHint(hints->next(game));
+        game.reset();
+        game.setValue(0, 0, 5);
+        game.undo();
+    }
+};
+
+TEST_F(SessionReplayTests, RecorderCapturesEveryCall) {
+    PlaySession();
+    // 10 accepted + 1 rejected moves, 3 undo, 1 redo, 1 hint, 1 reset, 1 more move.
+    EXPECT_GE(recorder.Size(), 17u);
+
+    const auto& events = recorder.Log().events;
+    EXPECT_EQ(events.front().type, SessionEvent::Type::SetValue);
+    EXPECT_TRUE(std::any_of(events.begin(), events.end(),
+        [](const SessionEvent& e) { return e.type == SessionEvent::Type::SetValue && !e.result; }));
+    EXPECT_TRUE(std::any_of(events.begin(), events.end(),
+        [](const SessionEvent& e) { return e.type == SessionEvent::Type::Hint; }));
+    for (std::size_t i = 1; i < events.size(); i++) {
+        EXPECT_GE(events[i].timeMs, events[i - 1].timeMs);
+    }
+}
+
+TEST_F(SessionReplayTests, ReplayReproducesEveryResult) {
+    PlaySession();
+
+    SessionReplayer replayer;
+    SessionReplayer::Result result;
+    ASSERT_TRUE(replayer.Replay(recorder.Log(), result));
+    EXPECT_EQ(result.sessions, 1u);
+    EXPECT_EQ(result.events, recorder.Size());
+    EXPECT_EQ(result.mismatches, 0u);
+    EXPECT_EQ(result.skippedHints, 0u);
+}
+
+TEST_F(SessionReplayTests, ChangedOutcomeIsReportedAsMismatch) {
+    PlaySession();
+    SessionLog log = recorder.Log();
+    log.events[0].result = !log.events[0].result;
+
+    SessionReplayer replayer;
+    SessionReplayer::Result result;
+    ASSERT_TRUE(replayer.Replay(log, result));
+    EXPECT_EQ(result.mismatches, 1u);
+}
+
+TEST_F(SessionReplayTests, HintsCanBeSkipped) {
+    PlaySession();
+
+    SessionReplayer replayer(false);
+    SessionReplayer::Result result;
+    ASSERT_TRUE(replayer.Replay(recorder.Log(), result));
+    EXPECT_EQ(result.skippedHints, 1u);
+    EXPECT_EQ(result.mismatches, 0u);
+}
+
+TEST_F(SessionReplayTests, LogFileRoundTrip) {
+    PlaySession();
+    ASSERT_TRUE(recorder.Log().Write(path));
+
+    SessionLog read;
+    ASSERT_TRUE(read.Read(path));
+    EXPECT_EQ(read.start, recorder.Log().start);
+    ASSERT_EQ(read.events.size(), recorder.Size());
+    for (std::size_t i = 0; i < read.events.size(); i++) {
+        const SessionEvent& a = read.events[i];
+        const SessionEvent& b = recorder.Log().events[i];
+        EXPECT_EQ(a.timeMs, b.timeMs);
+        EXPECT_EQ(a.type, b.type);
+        EXPECT_EQ(a.cell, b.cell);
+        EXPECT_EQ(a.value, b.value);
+        EXPECT_EQ(a.result, b.result);
+    }
+}
+
+TEST_F(SessionReplayTests, TruncatedLogIsRejected) {
+    PlaySession();
+    ASSERT_TRUE(recorder.Log().Write(path));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+
+    SessionLog read;
+    EXPECT_FALSE(read.Read(path));
+}
+
+TEST_F(SessionReplayTests, DetachedRecorderStopsRecording) {
+    game.setRecorder(nullptr);
+    game.setValue(0, 0, 1);
+    game.reset();
+    EXPECT_EQ(recorder.Size(), 0u);
+}
@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
+// Count heap allocations so tests can check that hot paths do not allocate.
+#define ALLOCATION_COUNTER_IMPLEMENTATION
+#include "../SudokuLib/AllocationCounter.h"
 
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
 
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
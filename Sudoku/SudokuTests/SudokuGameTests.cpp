@@ -2,6 +2,7 @@
 #include "../SudokuLib/SudokuGame.h"
 #include "../SudokuLib/Difficulty.h"
 #include "../SudokuLib/CellState.h"
+#include "../SudokuLib/BoardSnapshot.h"
 
 class SudokuGameBasicTests : public ::testing::Test {
 protected:
@@ -556,4 +557,42 @@ TEST_F(SudokuGameBasicTests, GeneratedPuzzleHasValidFixedCells) {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_F(SudokuGameBasicTests, BoardViewMatchesCellAccessors) {
+    game->startNewGame();
+    // Include a FILLED cell next to the FIXED and EMPTY ones.
+    for (int cell = 0; cell < 81; cell++) {
+        if (game->getCellState(cell / 9, cell % 9) == CellState::EMPTY) {
+            game->setValue(cell / 9, cell % 9, game->getSolutionValue(cell / 9, cell % 9));
+            break;
+        }
+    }
+
+    const BoardView board = game->getBoardView();
+    BoardSnapshot snapshot(*game);
+    const BoardView copied = snapshot.getBoardView();
+    for (int i = 0; i < 9; i++) {
+        for (int j = 0; j < 9; j++) {
+            EXPECT_EQ(board.Value(i, j), game->getValue(i, j));
+            EXPECT_EQ(board.State(i, j), game->getCellState(i, j));
+            EXPECT_EQ(copied.Value(i, j), game->getValue(i, j));
+            EXPECT_EQ(copied.State(i, j), game->getCellState(i, j));
+        }
+    }
+}
+
+TEST_F(SudokuGameBasicTests, BoardViewTracksLaterMoves) {
+    game->startNewGame();
+    const BoardView board = game->getBoardView();
+
+    for (int cell = 0; cell < 81; cell++) {
+        if (board.IsEmpty(cell)) {
+            int value = game->getSolutionValue(cell / 9, cell % 9);
+            ASSERT_TRUE(game->setValue(cell / 9, cell % 9, value));
+            EXPECT_EQ(board.Value(cell), value);
+            EXPECT_FALSE(board.IsFixed(cell));
+            return;
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "../SudokuLib/SudokuTransform.h"
+#include "../SudokuLib/PuzzleBank.h"
+#include "../SudokuLib/SudokuGenerator.h"
+#include "../SudokuLib/SudokuGame.h"
+
+class SudokuTransformTests : public ::testing::Test {
+protected:
+    SudokuBoard seed;
+    std::mt19937 engine{ 12345u };
+
+    void SetUp() override {
+        SudokuGenerator generator;
+        generator.Generate(seed, Difficulty::MEDIUM);
+    }
+
+    static bool IsValidSolution(const SudokuBoard& board) {
+        for (int i = 0; i < 9; i++) {
+            bool row[10] = { false }, col[10] = { false }, box[10] = { false };
+            for (int j = 0; j < 9; j++) {
+                int rv = board.GetSolution(i, j);
+                int cv = board.GetSolution(j, i);
+                int bv = board.GetSolution((i / 3) * 3 + j / 3, (i % 3) * 3 + j % 3);
+                if (rv < 1 || rv > 9 || row[rv]) return false;
+                if (cv < 1 || cv > 9 || col[cv]) return false;
+                if (bv < 1 || bv > 9 || box[bv]) return false;
+                row[rv] = col[cv] = box[bv] = true;
+            }
+        }
+        return true;
+    }
+
+    static int CountInitial(const SudokuBoard& board) {
+        int count = 0;
+        for (int i = 0; i < 9; i++)
+            for (int j = 0; j < 9; j++)
+                if (board.IsInitial(i, j)) count++;
+        return count;
+    }
+};
+
+TEST_F(SudokuTransformTests, IdentityLeavesBoardUnchanged) {
+    SudokuBoard out;
+    SudokuTransform::Identity().Apply(seed, out);
+
+    for (int i = 0; i < 9; i++) {
+        for (int j = 0; j < 9; j++) {
+            EXPECT_EQ(out.Get(i, j), seed.Get(i, j));
+            EXPECT_EQ(out.GetSolution(i, j), seed.GetSolution(i, j));
+            EXPECT_EQ(out.IsInitial(i, j), seed.IsInitial(i, j));
+        }
+    }
+}
+
+TEST_F(SudokuTransformTests, RandomTransformKeepsSolutionValid) {
+    for (int n = 0; n < 50; n++) {
+        SudokuBoard out;
+        SudokuTransform::Random(engine).Apply(seed, out);
+        EXPECT_TRUE(IsValidSolution(out));
+    }
+}
+
+TEST_F(SudokuTransformTests, RandomTransformKeepsGivensConsistentWithSolution) {
+    for (int n = 0; n < 50; n++) {
+        SudokuBoard out;
+        SudokuTransform::Random(engine).Apply(seed, out);
+
+        EXPECT_EQ(CountInitial(out), CountInitial(seed));
+        for (int i = 0; i < 9; i++) {
+            for (int j = 0; j < 9; j++) {
+                if (out.IsInitial(i, j)) {
+                    EXPECT_EQ(out.Get(i, j), out.GetSolution(i, j));
+                }
+                else {
+                    EXPECT_EQ(out.Get(i, j), 0);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(SudokuTransformTests, ApplyInPlaceMatchesApplyToCopy) {
+    SudokuTransform t = SudokuTransform::Random(engine);
+
+    SudokuBoard copy;
+    t.Apply(seed, copy);
+    t.Apply(seed, seed);
+
+    for (int i = 0; i < 9; i++) {
+        for (int j = 0; j < 9; j++) {
+            EXPECT_EQ(seed.Get(i, j), copy.Get(i, j));
+            EXPECT_EQ(seed.GetSolution(i, j), copy.GetSolution(i, j));
+        }
+    }
+}
+
+TEST_F(SudokuTransformTests, BankDeriveFailsWithoutSeeds) {
+    PuzzleBank bank;
+    SudokuBoard out;
+    EXPECT_EQ(bank.Size(Difficulty::HARD), 0u);
+    EXPECT_FALSE(bank.Derive(Difficulty::HARD, out));
+}
+
+TEST_F(SudokuTransformTests, GameServesPuzzlesFromBank) {
+    PuzzleBank bank;
+    bank.Add(Difficulty::MEDIUM, seed);
+
+    SudokuGame game(Difficulty::MEDIUM);
+    game.setPuzzleBank(&bank);
+    game.startNewGame();
+
+    int fixed = 0;
+    for (int i = 0; i < 9; i++) {
+        for (int j = 0; j < 9; j++) {
+            if (game.getCellState(i, j) == CellState::FIXED) {
+                fixed++;
+                EXPECT_EQ(game.getValue(i, j), game.getSolutionValue(i, j));
+            }
+        }
+    }
+    EXPECT_EQ(fixed, CountInitial(seed));
+}
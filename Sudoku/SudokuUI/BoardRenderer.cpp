@@ -0,0 +1,165 @@
+#include "BoardRenderer.h"
+#include "RenderStats.h"
+#include "../SudokuLib/ISudokuGame.h"
+#include <algorithm>
+
+namespace {
+    const sf::Color BOARD_BG_COLOR = sf::Color::White;
+    const sf::Color SHADOW_COLOR = sf::Color(0, 0, 0, 20);
+    const sf::Color THICK_LINE_COLOR = sf::Color(30, 30, 30);
+    const sf::Color THIN_LINE_COLOR = sf::Color(200, 200, 200);
+    const sf::Color FIXED_COLOR = sf::Color(30, 30, 30);
+    const sf::Color FILLED_COLOR = sf::Color(50, 120, 200);
+    const sf::Color HIGHLIGHT_FILL = sf::Color(251, 146, 60, 120);
+    const sf::Color HIGHLIGHT_BORDER = sf::Color(251, 146, 60);
+    const sf::Color SELECTED_FILL = sf::Color(99, 102, 241, 120);
+    const sf::Color SELECTED_BORDER = sf::Color(99, 102, 241);
+
+    constexpr float GRID_THICKNESS = 2.0f;
+    constexpr float THICK_LINE = 4.0f;
+}
+
+BoardRenderer::BoardRenderer(const sf::Font& font, sf::Vector2f origin, float cellSize)
+    : font(font), origin(origin), cellSize(cellSize) {
+    // Load every digit glyph up front so the atlas does not change while drawing.
+    for (char32_t d = U'1'; d <= U'9'; ++d) {
+        (void)font.getGlyph(d, DIGIT_SIZE, false);
+        (void)font.getGlyph(d, DIGIT_SIZE, true);
+    }
+}
+
+void BoardRenderer::update(const ISudokuGame* game, int selectedRow, int selectedCol) {
+    bool changed = dirty || selectedRow != builtRow || selectedCol != builtCol;
+
+    // The per-digit masks pin down every value, so comparing them replaces an
+    // 81-cell comparison on frames where nothing moved.
+    const BoardView board = game ? game->getBoardView() : BoardView{};
+    CellMask current[10];
+    if (game) std::copy(board.digits, board.digits + 10, current);
+    else current[0] = CellMask::All();
+
+    if (!std::equal(current, current + 10, digitCells)) {
+        std::copy(current, current + 10, digitCells);
+        for (int r = 0; r < 9; ++r) {
+            for (int c = 0; c < 9; ++c) {
+                values[r][c] = game ? board.Value(r, c) : 0;
+                fixedCells[r][c] = game && board.State(r, c) == CellState::FIXED;
+            }
+        }
+        changed = true;
+    }
+
+    if (changed) rebuild(selectedRow, selectedCol);
+}
+
+void BoardRenderer::rebuild(int selectedRow, int selectedCol) {
+    board.clear();
+    digits.clear();
+    selection.clear();
+
+    float boardSize = cellSize * 9.f;
+    addRect(board, origin - sf::Vector2f(4.f, 4.f), sf::Vector2f(boardSize + 8.f, boardSize + 8.f), BOARD_BG_COLOR);
+    addRect(board, origin - sf::Vector2f(6.f, 4.f), sf::Vector2f(boardSize + 12.f, boardSize + 12.f), SHADOW_COLOR);
+
+    for (int i = 0; i <= 9; ++i) {
+        float thick = (i % 3 == 0) ? THICK_LINE : GRID_THICKNESS;
+        sf::Color color = (i % 3 == 0) ? THICK_LINE_COLOR : THIN_LINE_COLOR;
+        addRect(board, origin + sf::Vector2f(0.f, i * cellSize), sf::Vector2f(boardSize, thick), color);
+        addRect(board, origin + sf::Vector2f(i * cellSize, 0.f), sf::Vector2f(thick, boardSize), color);
+    }
+
+    bool hasSelection = selectedRow >= 0 && selectedCol >= 0;
+    int selVal = hasSelection ? values[selectedRow][selectedCol] : 0;
+
+    // Same-value highlights visit only the cells holding the selected digit.
+    if (selVal != 0) {
+        digitCells[selVal].ForEach([&](int index) {
+            int r = index / 9, c = index % 9;
+            if (r == selectedRow && c == selectedCol) return;
+            sf::Vector2f cell = origin + sf::Vector2f(c * cellSize, r * cellSize);
+            addRect(board, cell + sf::Vector2f(1.f, 1.f), sf::Vector2f(cellSize - 2.f, cellSize - 2.f), HIGHLIGHT_FILL);
+            addFrame(board, cell, cellSize, 3.f, HIGHLIGHT_BORDER);
+        });
+    }
+
+    for (int r = 0; r < 9; ++r)
+        for (int c = 0; c < 9; ++c)
+            if (values[r][c] != 0) addDigit(r, c, values[r][c], fixedCells[r][c]);
+
+    if (hasSelection) {
+        sf::Vector2f cell = origin + sf::Vector2f(selectedCol * cellSize, selectedRow * cellSize);
+        addRect(selection, cell + sf::Vector2f(1.f, 1.f), sf::Vector2f(cellSize - 2.f, cellSize - 2.f), SELECTED_FILL);
+        addFrame(selection, cell, cellSize, 5.f, SELECTED_BORDER);
+    }
+
+    builtRow = selectedRow;
+    builtCol = selectedCol;
+    dirty = false;
+}
+
+void BoardRenderer::addDigit(int row, int col, int value, bool fixed) {
+    const sf::Glyph& glyph = font.getGlyph(static_cast<char32_t>(U'0' + value), DIGIT_SIZE, fixed);
+    sf::Color color = fixed ? FIXED_COLOR : FILLED_COLOR;
+
+    // Same placement as a centered sf::Text: the glyph box is centered in the
+    // cell and lifted by 5px. Like sf::Text, the quad is padded by one pixel.
+    const float padding = 1.f;
+    sf::Vector2f size = glyph.bounds.size;
+    sf::Vector2f textPos = origin + sf::Vector2f(
+        col * cellSize + (cellSize - size.x) / 2.f,
+        row * cellSize + (cellSize - size.y) / 2.f - 5.f);
+    sf::Vector2f topLeft = textPos + sf::Vector2f(glyph.bounds.position.x - padding,
+        static_cast<float>(DIGIT_SIZE) + glyph.bounds.position.y - padding);
+    sf::Vector2f quad = size + sf::Vector2f(2.f * padding, 2.f * padding);
+
+    sf::Vector2f uv(static_cast<float>(glyph.textureRect.position.x) - padding,
+        static_cast<float>(glyph.textureRect.position.y) - padding);
+    sf::Vector2f uvSize(static_cast<float>(glyph.textureRect.size.x) + 2.f * padding,
+        static_cast<float>(glyph.textureRect.size.y) + 2.f * padding);
+
+    sf::Vertex tl{ topLeft, color, uv };
+    sf::Vertex tr{ topLeft + sf::Vector2f(quad.x, 0.f), color, uv + sf::Vector2f(uvSize.x, 0.f) };
+    sf::Vertex bl{ topLeft + sf::Vector2f(0.f, quad.y), color, uv + sf::Vector2f(0.f, uvSize.y) };
+    sf::Vertex br{ topLeft + quad, color, uv + uvSize };
+
+    digits.append(tl);
+    digits.append(tr);
+    digits.append(bl);
+    digits.append(bl);
+    digits.append(tr);
+    digits.append(br);
+}
+
+void BoardRenderer::addRect(sf::VertexArray& va, sf::Vector2f pos, sf::Vector2f size, sf::Color color) {
+    sf::Vertex tl{ pos, color };
+    sf::Vertex tr{ pos + sf::Vector2f(size.x, 0.f), color };
+    sf::Vertex bl{ pos + sf::Vector2f(0.f, size.y), color };
+    sf::Vertex br{ pos + size, color };
+
+    va.append(tl);
+    va.append(tr);
+    va.append(bl);
+    va.append(bl);
+    va.append(tr);
+    va.append(br);
+}
+
+void BoardRenderer::addFrame(sf::VertexArray& va, sf::Vector2f pos, float size, float thickness, sf::Color color) {
+    // Inner border, like a RectangleShape with a negative outline thickness.
+    addRect(va, pos, sf::Vector2f(size, thickness), color);
+    addRect(va, pos + sf::Vector2f(0.f, size - thickness), sf::Vector2f(size, thickness), color);
+    addRect(va, pos + sf::Vector2f(0.f, thickness), sf::Vector2f(thickness, size - 2.f * thickness), color);
+    addRect(va, pos + sf::Vector2f(size - thickness, thickness), sf::Vector2f(thickness, size - 2.f * thickness), color);
+}
+
+void BoardRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    RenderStats::draw(target, board, states);
+
+    if (digits.getVertexCount() > 0) {
+        sf::RenderStates textStates = states;
+        textStates.texture = &font.getTexture(DIGIT_SIZE);
+        RenderStats::draw(target, digits, textStates);
+    }
+
+    if (selection.getVertexCount() > 0) RenderStats::draw(target, selection, states);
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "CellState.h"
+#include "CellMask.h"
+
+class ISudokuGame;
+
+/**
+ * @brief Batched renderer for the Sudoku board.
+ *
+ * The board background, grid lines, value highlights and the selection are
+ * baked into vertex arrays of triangles, and the digits into a single array of
+ * glyph quads textured from the font atlas. The arrays are rebuilt only when the
+ * board contents or the selection change, and the whole board is drawn with
+ * three draw calls.
+ */
+class BoardRenderer : public sf::Drawable {
+public:
+    BoardRenderer(const sf::Font& font, sf::Vector2f origin, float cellSize);
+
+    /**
+     * @brief Rebuild the vertex arrays if the board or the selection changed since the last call.
+     *
+     * @param game Game to read the board from; nullptr draws an empty grid.
+     * @param selectedRow Selected row, or -1 for none.
+     * @param selectedCol Selected column, or -1 for none.
+     */
+    void update(const ISudokuGame* game, int selectedRow, int selectedCol);
+
+    /**
+     * @brief Force a rebuild on the next update().
+     */
+    void invalidate() { dirty = true; }
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    void rebuild(int selectedRow, int selectedCol);
+    void addDigit(int row, int col, int value, bool fixed);
+
+    static void addRect(sf::VertexArray& va, sf::Vector2f pos, sf::Vector2f size, sf::Color color);
+    static void addFrame(sf::VertexArray& va, sf::Vector2f pos, float size, float thickness, sf::Color color);
+
+    static constexpr unsigned int DIGIT_SIZE = 32;
+
+    const sf::Font& font;
+    sf::Vector2f origin;
+    float cellSize;
+
+    /** @brief Background, grid lines and same-value highlights (drawn below the digits). */
+    sf::VertexArray board{ sf::PrimitiveType::Triangles };
+
+    /** @brief One textured quad per digit. */
+    sf::VertexArray digits{ sf::PrimitiveType::Triangles };
+
+    /** @brief Selected cell fill and border (drawn above the digits). */
+    sf::VertexArray selection{ sf::PrimitiveType::Triangles };
+
+    /** @brief Board state the arrays were built from, used to skip redundant rebuilds. */
+    int values[9][9] = {};
+    bool fixedCells[9][9] = {};
+    CellMask digitCells[10];
+    int builtRow = -2;
+    int builtCol = -2;
+    bool dirty = true;
+};
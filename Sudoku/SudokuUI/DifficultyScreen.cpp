@@ -1,14 +1,15 @@
 #include "DifficultyScreen.h"
+#include "RenderStats.h"
 #include "Difficulty.h"
 #include <SFML/Graphics.hpp>
 #include "../SudokuLib/ISudokuGame.h"
 #include "ScreenManager.h"
 
-DifficultyScreen::DifficultyScreen(ScreenManager& mgr, sf::RenderWindow& win)
-    : manager(mgr), window(win), showDifficultyMenu(true) {
+DifficultyScreen::DifficultyScreen(ScreenManager& mgr, sf::RenderTarget& win)
+    : manager(mgr), window(win), showDifficultyMenu(true), canContinue(mgr.hasSavedGame()) {
 }
 
-void DifficultyScreen::drawDifficultyMenu() {
+void DifficultyScreen::drawDifficultyMenu(sf::RenderTarget& target) {
     sf::Font& font = manager.getFont();
 
     sf::Text title(font);
@@ -18,7 +19,7 @@ void DifficultyScreen::drawDifficultyMenu() {
     title.setStyle(sf::Text::Bold);
     sf::FloatRect titleBounds = title.getLocalBounds();
     title.setPosition(sf::Vector2f(350 - titleBounds.size.x / 2, 120));
-    window.draw(title);
+    RenderStats::draw(target, title);
 
     sf::Text subtitle(font);
     subtitle.setString("Select your challenge level");
@@ -26,7 +27,7 @@ void DifficultyScreen::drawDifficultyMenu() {
     subtitle.setFillColor(sf::Color(100, 100, 120));
     sf::FloatRect subBounds = subtitle.getLocalBounds();
     subtitle.setPosition(sf::Vector2f(350 - subBounds.size.x / 2, 180));
-    window.draw(subtitle);
+    RenderStats::draw(target, subtitle);
 
     float btnWidth = 250.f;
     float btnHeight = 70.f;
@@ -51,12 +52,12 @@ void DifficultyScreen::drawDifficultyMenu() {
         sf::RectangleShape shadow(sf::Vector2f(btnWidth + 6.f, btnHeight + 6.f));
         shadow.setPosition(sf::Vector2f(centerX - btnWidth / 2.f + 3.f, btn.y + 3.f));
         shadow.setFillColor(sf::Color(0, 0, 0, 30));
-        window.draw(shadow);
+        RenderStats::draw(target, shadow);
 
         sf::RectangleShape rect(sf::Vector2f(btnWidth, btnHeight));
         rect.setPosition(sf::Vector2f(centerX - btnWidth / 2.f, btn.y));
         rect.setFillColor(btn.color);
-        window.draw(rect);
+        RenderStats::draw(target, rect);
 
         sf::Text text(font);
         text.setString(btn.text);
@@ -64,23 +65,49 @@ void DifficultyScreen::drawDifficultyMenu() {
         text.setFillColor(sf::Color::White);
         text.setStyle(sf::Text::Bold);
         text.setPosition(sf::Vector2f(centerX - 90.f, btn.y + 12.f));
-        window.draw(text);
+        RenderStats::draw(target, text);
 
         sf::Text desc(font);
         desc.setString(btn.desc);
         desc.setCharacterSize(14);
         desc.setFillColor(sf::Color(255, 255, 255, 200));
         desc.setPosition(sf::Vector2f(centerX - 90.f, btn.y + 40.f));
-        window.draw(desc);
+        RenderStats::draw(target, desc);
     }
-}
 
-void DifficultyScreen::render(sf::RenderWindow& window) {
-    window.clear(sf::Color(240, 242, 245));
-    if (showDifficultyMenu) {
-        drawDifficultyMenu();
+    if (canContinue) {
+        float y = startY + 3 * (btnHeight + spacing);
+
+        sf::RectangleShape rect(sf::Vector2f(btnWidth, btnHeight));
+        rect.setPosition(sf::Vector2f(centerX - btnWidth / 2.f, y));
+        rect.setFillColor(sf::Color(99, 102, 241));
+        RenderStats::draw(target, rect);
+
+        sf::Text text(font);
+        text.setString("Continue");
+        text.setCharacterSize(28);
+        text.setFillColor(sf::Color::White);
+        text.setStyle(sf::Text::Bold);
+        text.setPosition(sf::Vector2f(centerX - 90.f, y + 12.f));
+        RenderStats::draw(target, text);
+
+        sf::Text desc(font);
+        desc.setString("Resume your last game");
+        desc.setCharacterSize(14);
+        desc.setFillColor(sf::Color(255, 255, 255, 200));
+        desc.setPosition(sf::Vector2f(centerX - 90.f, y + 40.f));
+        RenderStats::draw(target, desc);
     }
-    window.display();
+}
+
+void DifficultyScreen::render(sf::RenderTarget& window) {
+    // The whole menu is static, so it lives entirely in the cached layer.
+    layer.draw(window, [this](sf::RenderTarget& target) {
+        target.clear(sf::Color(240, 242, 245));
+        if (showDifficultyMenu) {
+            drawDifficultyMenu(target);
+        }
+    });
 }
 
 void DifficultyScreen::handleMouseClick(int x, int y) {
@@ -93,6 +120,7 @@ void DifficultyScreen::handleMouseClick(int x, int y) {
     sf::FloatRect easyRect(sf::Vector2f(centerX - btnWidth / 2.f, startY), sf::Vector2f(btnWidth, btnHeight));
     sf::FloatRect mediumRect(sf::Vector2f(centerX - btnWidth / 2.f, startY + btnHeight + spacing), sf::Vector2f(btnWidth, btnHeight));
     sf::FloatRect hardRect(sf::Vector2f(centerX - btnWidth / 2.f, startY + 2 * (btnHeight + spacing)), sf::Vector2f(btnWidth, btnHeight));
+    sf::FloatRect continueRect(sf::Vector2f(centerX - btnWidth / 2.f, startY + 3 * (btnHeight + spacing)), sf::Vector2f(btnWidth, btnHeight));
 
     sf::Vector2f clickPos(static_cast<float>(x), static_cast<float>(y));
 
@@ -105,6 +133,13 @@ void DifficultyScreen::handleMouseClick(int x, int y) {
     else if (hardRect.contains(clickPos)) {
         manager.createGame(Difficulty::HARD, window);
     }
+    else if (canContinue && continueRect.contains(clickPos)) {
+        if (!manager.resumeGame(window)) {
+            // Unreadable save: hide the button.
+            canContinue = false;
+            layer.invalidate();
+        }
+    }
 }
 
 void DifficultyScreen::handleKeyPress(sf::Keyboard::Key key) {}
@@ -1,19 +1,23 @@
 #pragma once
 #include "IScreen.h"
 #include "ScreenManager.h"
+#include "StaticLayer.h"
 #include <SFML/Graphics.hpp>
 
 class DifficultyScreen : public IScreen {
 private:
     ScreenManager& manager;
-    sf::RenderWindow& window;
+    sf::RenderTarget& window;
     bool showDifficultyMenu;
+    // A saved game exists, so the Continue button is shown.
+    bool canContinue;
+    StaticLayer layer;
 
-    void drawDifficultyMenu();
+    void drawDifficultyMenu(sf::RenderTarget& target);
 
 public:
-    explicit DifficultyScreen(ScreenManager& mgr, sf::RenderWindow& win);
-    void render(sf::RenderWindow& window) override;
+    explicit DifficultyScreen(ScreenManager& mgr, sf::RenderTarget& win);
+    void render(sf::RenderTarget& window) override;
     void handleMouseClick(int x, int y) override;
     void handleKeyPress(sf::Keyboard::Key key) override;
     void handleTextInput(uint32_t unicode) override;
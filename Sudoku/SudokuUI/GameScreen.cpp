@@ -3,151 +3,63 @@
 #include "CellState.h"
 #include "ScreenManager.h"
 #include "ScoreManager.h"
+#include "RenderStats.h"
+#include "../SudokuLib/PerfStats.h"
 #include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
 
-GameScreen::GameScreen(ScreenManager& mgr, sf::RenderWindow& win)
+GameScreen::GameScreen(ScreenManager& mgr, sf::RenderTarget& win)
     : manager(mgr), game(mgr.getGame()), window(win), font(mgr.getFont()),
+    boardRenderer(mgr.getFont(), sf::Vector2f(BOARD_OFFSET_X, BOARD_OFFSET_Y), CELL_SIZE),
+    texts(mgr.getFont()),
     selectedRow(-1), selectedCol(-1),
     gameWon(false), gameLost(false)
 {
     if (game) game->attachObserver(this);
-}
-
-void GameScreen::render(sf::RenderWindow&) {
-    window.clear(BACKGROUND_COLOR);
-
-    drawGrid();
-    drawHighlights();
-    drawNumbers();
-    drawSelection();
-    drawInfo();
-    drawGameOverlay();
-    drawHintOverlay();
-
-    window.display();
-}
-
-void GameScreen::drawGrid() {
-    sf::RectangleShape boardBg(sf::Vector2f(CELL_SIZE * 9 + 8.f, CELL_SIZE * 9 + 8.f));
-    boardBg.setPosition(sf::Vector2f(BOARD_OFFSET_X - 4.f, BOARD_OFFSET_Y - 4.f));
-    boardBg.setFillColor(sf::Color::White);
-    window.draw(boardBg);
-
-    sf::RectangleShape shadow(sf::Vector2f(CELL_SIZE * 9 + 12.f, CELL_SIZE * 9 + 12.f));
-    shadow.setPosition(sf::Vector2f(BOARD_OFFSET_X - 6.f, BOARD_OFFSET_Y - 4.f));
-    shadow.setFillColor(sf::Color(0, 0, 0, 20));
-    window.draw(shadow);
-
-    for (int i = 0; i <= 9; ++i) {
-        float thick = (i % 3 == 0) ? THICK_LINE : GRID_THICKNESS;
-        sf::Color color = (i % 3 == 0) ? sf::Color(30, 30, 30) : sf::Color(200, 200, 200);
-
-        sf::RectangleShape hLine(sf::Vector2f(CELL_SIZE * 9.f, thick));
-        hLine.setPosition(sf::Vector2f(BOARD_OFFSET_X, BOARD_OFFSET_Y + i * CELL_SIZE));
-        hLine.setFillColor(color);
-        window.draw(hLine);
 
-        sf::RectangleShape vLine(sf::Vector2f(thick, CELL_SIZE * 9.f));
-        vLine.setPosition(sf::Vector2f(BOARD_OFFSET_X + i * CELL_SIZE, BOARD_OFFSET_Y));
-        vLine.setFillColor(color);
-        window.draw(vLine);
+    auto provider = manager.getHintManager();
+    if (game && provider && manager.getPrecomputeHints()) {
+        precomputer = std::make_unique<HintPrecomputer>(*game, provider, manager.getHintService());
     }
 }
 
-void GameScreen::drawSelection() {
-    if (selectedRow < 0 || selectedCol < 0) return;
-
-    sf::RectangleShape selBg(sf::Vector2f(CELL_SIZE - 2.f, CELL_SIZE - 2.f));
-    selBg.setPosition(sf::Vector2f(
-        BOARD_OFFSET_X + selectedCol * CELL_SIZE + 1.f,
-        BOARD_OFFSET_Y + selectedRow * CELL_SIZE + 1.f
-    ));
-    selBg.setFillColor(sf::Color(99, 102, 241, 120));
-    window.draw(selBg);
-
-    sf::RectangleShape border(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-    border.setPosition(sf::Vector2f(
-        BOARD_OFFSET_X + selectedCol * CELL_SIZE,
-        BOARD_OFFSET_Y + selectedRow * CELL_SIZE
-    ));
-    border.setFillColor(sf::Color::Transparent);
-    border.setOutlineThickness(-5.f);
-    border.setOutlineColor(sf::Color(99, 102, 241));
-    window.draw(border);
+GameScreen::~GameScreen() {
+    if (game) game->detachObserver(this);
 }
 
-void GameScreen::drawHighlights() {
-    if (!game) return;
-    if (selectedRow < 0 || selectedCol < 0) return;
+void GameScreen::render(sf::RenderTarget&) {
+    // Clear the flags first so changes made while drawing trigger another frame.
+    boardDirty = false;
+    lastDrawnSeconds = game ? game->getElapsedTime() : -1;
 
-    int selVal = game->getValue(selectedRow, selectedCol);
-    if (selVal == 0) return;
-
-    for (int r = 0; r < 9; ++r) {
-        for (int c = 0; c < 9; ++c) {
-            if (game->getValue(r, c) == selVal && !(r == selectedRow && c == selectedCol)) {
-                sf::RectangleShape h(sf::Vector2f(CELL_SIZE - 2.f, CELL_SIZE - 2.f));
-                h.setPosition(sf::Vector2f(
-                    BOARD_OFFSET_X + c * CELL_SIZE + 1.f,
-                    BOARD_OFFSET_Y + r * CELL_SIZE + 1.f
-                ));
-                h.setFillColor(sf::Color(251, 146, 60, 120));
-                window.draw(h);
-
-                sf::RectangleShape outline(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                outline.setPosition(sf::Vector2f(
-                    BOARD_OFFSET_X + c * CELL_SIZE,
-                    BOARD_OFFSET_Y + r * CELL_SIZE
-                ));
-                outline.setFillColor(sf::Color::Transparent);
-                outline.setOutlineThickness(-3.f);
-                outline.setOutlineColor(sf::Color(251, 146, 60));
-                window.draw(outline);
-            }
-        }
+    if (game && game->getCurrentDifficulty() != chromeDifficulty) {
+        chromeDifficulty = game->getCurrentDifficulty();
+        chrome.invalidate();
     }
-}
+    chrome.draw(window, [this](sf::RenderTarget& target) { drawChrome(target); });
 
-void GameScreen::drawNumbers() {
-    if (!game) return;
-    for (int row = 0; row < 9; row++) {
-        for (int col = 0; col < 9; col++) {
-            int value = game->getValue(row, col);
-            if (value != 0) {
-                CellState state = game->getCellState(row, col);
-
-                sf::Text text(font);
-                text.setString(std::to_string(value));
-                text.setCharacterSize(32);
-
-                if (state == CellState::FIXED) {
-                    text.setFillColor(FIXED_COLOR);
-                    text.setStyle(sf::Text::Bold);
-                }
-                else {
-                    text.setFillColor(FILLED_COLOR);
-                }
-
-                sf::FloatRect bounds = text.getLocalBounds();
-                text.setPosition(sf::Vector2f(
-                    BOARD_OFFSET_X + col * CELL_SIZE + (CELL_SIZE - bounds.size.x) / 2,
-                    BOARD_OFFSET_Y + row * CELL_SIZE + (CELL_SIZE - bounds.size.y) / 2 - 5
-                ));
-
-                window.draw(text);
-            }
-        }
-    }
+    collectHint();
+    boardRenderer.update(game, selectedRow, selectedCol);
+    window.draw(boardRenderer); // counts its own draw calls
+    drawInfo();
+    drawGameOverlay();
+    drawHintOverlay();
+    drawPerfOverlay();
 }
 
-void GameScreen::drawInfo() {
+void GameScreen::drawChrome(sf::RenderTarget& target) {
+    target.clear(BACKGROUND_COLOR);
     if (!game) return;
 
     sf::RectangleShape headerBg(sf::Vector2f(750, 70));
     headerBg.setPosition(sf::Vector2f(0, 0));
     headerBg.setFillColor(sf::Color(30, 30, 40));
-    window.draw(headerBg);
+    RenderStats::draw(target, headerBg);
 
     sf::Text title(font);
     title.setString("SUDOKU");
@@ -155,7 +67,7 @@ void GameScreen::drawInfo() {
     title.setFillColor(sf::Color::White);
     title.setStyle(sf::Text::Bold);
     title.setPosition(sf::Vector2f(BOARD_OFFSET_X, 10));
-    window.draw(title);
+    RenderStats::draw(target, title);
 
     std::string diffStr;
     sf::Color diffColor;
@@ -178,7 +90,7 @@ void GameScreen::drawInfo() {
     sf::RectangleShape diffBadge(sf::Vector2f(80, 30));
     diffBadge.setPosition(sf::Vector2f(BOARD_OFFSET_X + 230, 28));
     diffBadge.setFillColor(diffColor);
-    window.draw(diffBadge);
+    RenderStats::draw(target, diffBadge);
 
     sf::Text diffText(font);
     diffText.setString(diffStr);
@@ -190,51 +102,31 @@ void GameScreen::drawInfo() {
         BOARD_OFFSET_X + 270 - diffBounds.size.x / 2,
         33
     ));
-    window.draw(diffText);
+    RenderStats::draw(target, diffText);
 
     sf::RectangleShape attemptsBadge(sf::Vector2f(120, 30));
     attemptsBadge.setPosition(sf::Vector2f(BOARD_OFFSET_X + 330, 28));
     attemptsBadge.setFillColor(sf::Color(50, 50, 60));
-    window.draw(attemptsBadge);
-
-    sf::Text attemptsText(font);
-    attemptsText.setString("Lives: " + std::to_string(game->getRemainingAttempts()));
-    attemptsText.setCharacterSize(16);
-    attemptsText.setFillColor(sf::Color::White);
-    attemptsText.setStyle(sf::Text::Bold);
-    attemptsText.setPosition(sf::Vector2f(BOARD_OFFSET_X + 345, 33));
-    window.draw(attemptsText);
+    RenderStats::draw(target, attemptsBadge);
 
     sf::RectangleShape timerBadge(sf::Vector2f(100, 30));
     timerBadge.setPosition(sf::Vector2f(BOARD_OFFSET_X + CELL_SIZE * 9 - 100, 28));
     timerBadge.setFillColor(PRIMARY_COLOR);
-    window.draw(timerBadge);
-
-    sf::Text timer(font);
-    timer.setString(ScoreManager::formatTime(game->getElapsedTime()));
-    timer.setCharacterSize(18);
-    timer.setFillColor(sf::Color::White);
-    timer.setStyle(sf::Text::Bold);
-    sf::FloatRect timerBounds = timer.getLocalBounds();
-    timer.setPosition(sf::Vector2f(
-        BOARD_OFFSET_X + CELL_SIZE * 9 - 50 - timerBounds.size.x / 2,
-        30
-    ));
-    window.draw(timer);
+    RenderStats::draw(target, timerBadge);
 
     sf::Text controls(font);
     controls.setString("1-9: Fill | 0/Del: Clear | Arrows: Move | H: Hint");
     controls.setCharacterSize(13);
     controls.setFillColor(sf::Color(120, 120, 120));
     controls.setPosition(sf::Vector2f(BOARD_OFFSET_X, BOARD_OFFSET_Y + CELL_SIZE * 9 + 20));
-    window.draw(controls);
+    RenderStats::draw(target, controls);
 
     float buttonY = BOARD_OFFSET_Y + CELL_SIZE * 9 + 50;
 
     sf::RectangleShape mainMenuBtn(sf::Vector2f(110, 38));
     mainMenuBtn.setPosition(sf::Vector2f(BOARD_OFFSET_X + CELL_SIZE * 9 - 350, buttonY));
     mainMenuBtn.setFillColor(sf::Color(100, 100, 120));
-    window.draw(mainMenuBtn);
+    RenderStats::draw(target, mainMenuBtn);
 
     sf::Text mainMenuText(font);
     mainMenuText.setString("Main Menu");
@@ -246,12 +138,12 @@ void GameScreen::drawInfo() {
         BOARD_OFFSET_X + CELL_SIZE * 9 - 295 - mainMenuBounds.size.x / 2,
         buttonY + (38 - mainMenuBounds.size.y) / 2 - 3
     ));
-    window.draw(mainMenuText);
+    RenderStats::draw(target, mainMenuText);
 
     sf::RectangleShape resetBtn(sf::Vector2f(110, 38));
     resetBtn.setPosition(sf::Vector2f(BOARD_OFFSET_X + CELL_SIZE * 9 - 230, buttonY));
     resetBtn.setFillColor(PRIMARY_COLOR);
-    window.draw(resetBtn);
+    RenderStats::draw(target, resetBtn);
 
     sf::Text resetText(font);
     resetText.setString("New Game");
@@ -263,12 +155,12 @@ void GameScreen::drawInfo() {
         BOARD_OFFSET_X + CELL_SIZE * 9 - 175 - resetBounds.size.x / 2,
         buttonY + (38 - resetBounds.size.y) / 2 - 3
     ));
-    window.draw(resetText);
+    RenderStats::draw(target, resetText);
 
     sf::RectangleShape hintBtn(sf::Vector2f(110, 38));
     hintBtn.setPosition(sf::Vector2f(BOARD_OFFSET_X + CELL_SIZE * 9 - 110, buttonY));
     hintBtn.setFillColor(HINT_COLOR);
-    window.draw(hintBtn);
+    RenderStats::draw(target, hintBtn);
 
     sf::Text hintText(font);
     hintText.setString("Hint");
@@ -280,7 +172,40 @@ void GameScreen::drawInfo() {
         BOARD_OFFSET_X + CELL_SIZE * 9 - 55 - hintBounds.size.x / 2,
         buttonY + (38 - hintBounds.size.y) / 2 - 3
     ));
-    window.draw(hintText);
+    RenderStats::draw(target, hintText);
+}
+
+void GameScreen::drawInfo() {
+    if (!game) return;
+
+    sf::Text& attemptsText = texts.get(TEXT_LIVES,
+        "Lives: " + std::to_string(game->getRemainingAttempts()), 16, sf::Color::White, sf::Text::Bold);
+    attemptsText.setPosition(sf::Vector2f(BOARD_OFFSET_X + 345, 33));
+    RenderStats::draw(window, attemptsText);
+
+    sf::Text& timer = texts.get(TEXT_TIMER,
+        ScoreManager::formatTime(game->getElapsedTime()), 18, sf::Color::White, sf::Text::Bold);
+    sf::FloatRect timerBounds = timer.getLocalBounds();
+    timer.setPosition(sf::Vector2f(
+        BOARD_OFFSET_X + CELL_SIZE * 9 - 50 - timerBounds.size.x / 2,
+        30
+    ));
+    RenderStats::draw(window, timer);
+
+    // How many of the selected digit are on the board, from the board's per-digit mask.
+    if (selectedRow >= 0 && selectedCol >= 0) {
+        const BoardView board = game->getBoardView();
+        int digit = board.Value(selectedRow, selectedCol);
+        if (digit != 0) {
+            sf::Text& count = texts.get(TEXT_DIGIT_COUNT,
+                std::to_string(digit) + ": " + std::to_string(board.Cells(digit).Count()) + " of 9 placed",
+                13, sf::Color(120, 120, 120));
+            count.setPosition(sf::Vector2f(
+                BOARD_OFFSET_X + CELL_SIZE * 9 - count.getLocalBounds().size.x,
+                BOARD_OFFSET_Y + CELL_SIZE * 9 + 20));
+            RenderStats::draw(window, count);
+        }
+    }
 }
 
 void GameScreen::drawGameOverlay() {
@@ -290,63 +215,44 @@ void GameScreen::drawGameOverlay() {
         sf::RectangleShape overlay(sf::Vector2f(500, 180));
         overlay.setPosition(sf::Vector2f(100, 340));
         overlay.setFillColor(sf::Color(0, 0, 0, 220));
-        window.draw(overlay);
+        RenderStats::draw(window, overlay);
 
-        sf::Text winText(font);
-        winText.setString("YOU WON!");
-        winText.setCharacterSize(56);
-        winText.setFillColor(sf::Color(100, 255, 100));
-        winText.setStyle(sf::Text::Bold);
+        sf::Text& winText = texts.get(TEXT_OVERLAY_TITLE, "YOU WON!", 56, sf::Color(100, 255, 100), sf::Text::Bold);
         sf::FloatRect bounds = winText.getLocalBounds();
         winText.setPosition(sf::Vector2f(350 - bounds.size.x / 2, 360));
-        window.draw(winText);
+        RenderStats::draw(window, winText);
 
-        sf::Text timeText(font);
-        timeText.setString("Time: " + ScoreManager::formatTime(game->getElapsedTime()));
-        timeText.setCharacterSize(24);
-        timeText.setFillColor(sf::Color::White);
+        sf::Text& timeText = texts.get(TEXT_OVERLAY_INFO,
+            "Time: " + ScoreManager::formatTime(game->getElapsedTime()), 24, sf::Color::White);
         sf::FloatRect timeBounds = timeText.getLocalBounds();
         timeText.setPosition(sf::Vector2f(350 - timeBounds.size.x / 2, 435));
-        window.draw(timeText);
+        RenderStats::draw(window, timeText);
 
-        sf::Text clickText(font);
-        clickText.setString("Click anywhere to continue");
-        clickText.setCharacterSize(16);
-        clickText.setFillColor(sf::Color(200, 200, 200));
+        sf::Text& clickText = texts.get(TEXT_OVERLAY_CLICK, "Click anywhere to continue", 16, sf::Color(200, 200, 200));
         sf::FloatRect clickBounds = clickText.getLocalBounds();
         clickText.setPosition(sf::Vector2f(350 - clickBounds.size.x / 2, 480));
-        window.draw(clickText);
+        RenderStats::draw(window, clickText);
     }
     else if (gameLost) {
         sf::RectangleShape overlay(sf::Vector2f(500, 180));
         overlay.setPosition(sf::Vector2f(100, 340));
         overlay.setFillColor(sf::Color(0, 0, 0, 220));
-        window.draw(overlay);
+        RenderStats::draw(window, overlay);
 
-        sf::Text loseText(font);
-        loseText.setString("GAME OVER!");
-        loseText.setCharacterSize(56);
-        loseText.setFillColor(sf::Color(255, 100, 100));
-        loseText.setStyle(sf::Text::Bold);
+        sf::Text& loseText = texts.get(TEXT_OVERLAY_TITLE, "GAME OVER!", 56, sf::Color(255, 100, 100), sf::Text::Bold);
         sf::FloatRect bounds = loseText.getLocalBounds();
         loseText.setPosition(sf::Vector2f(350 - bounds.size.x / 2, 360));
-        window.draw(loseText);
+        RenderStats::draw(window, loseText);
 
-        sf::Text infoText(font);
-        infoText.setString("No attempts remaining!");
-        infoText.setCharacterSize(24);
-        infoText.setFillColor(sf::Color::White);
+        sf::Text& infoText = texts.get(TEXT_OVERLAY_INFO, "No attempts remaining!", 24, sf::Color::White);
         sf::FloatRect infoBounds = infoText.getLocalBounds();
         infoText.setPosition(sf::Vector2f(350 - infoBounds.size.x / 2, 435));
-        window.draw(infoText);
+        RenderStats::draw(window, infoText);
 
-        sf::Text clickText(font);
-        clickText.setString("Click to return to main menu");
-        clickText.setCharacterSize(16);
-        clickText.setFillColor(sf::Color(200, 200, 200));
+        sf::Text& clickText = texts.get(TEXT_OVERLAY_CLICK, "Click to return to main menu", 16, sf::Color(200, 200, 200));
         sf::FloatRect clickBounds = clickText.getLocalBounds();
         clickText.setPosition(sf::Vector2f(350 - clickBounds.size.x / 2, 480));
-        window.draw(clickText);
+        RenderStats::draw(window, clickText);
     }
 }
 
@@ -362,7 +268,7 @@ void GameScreen::drawHintOverlay() {
             BOARD_OFFSET_Y + h.row * CELL_SIZE + 1.f
         ));
         sel.setFillColor(sf::Color(HINT_COLOR.r, HINT_COLOR.g, HINT_COLOR.b, 120));
-        window.draw(sel);
+        RenderStats::draw(window, sel);
 
         sf::RectangleShape outline(sf::Vector2f(CELL_SIZE, CELL_SIZE));
         outline.setPosition(sf::Vector2f(
@@ -372,21 +278,18 @@ void GameScreen::drawHintOverlay() {
         outline.setFillColor(sf::Color::Transparent);
         outline.setOutlineThickness(-3.f);
         outline.setOutlineColor(HINT_COLOR);
-        window.draw(outline);
+        RenderStats::draw(window, outline);
     }
 
     // Message box
     sf::RectangleShape box(sf::Vector2f(500.f, 70.f));
     box.setPosition(sf::Vector2f(BOARD_OFFSET_X, BOARD_OFFSET_Y - 70.f));
     box.setFillColor(sf::Color(20, 20, 30, 230));
-    window.draw(box);
+    RenderStats::draw(window, box);
 
-    sf::Text msg(font);
-    msg.setString(h.message);
-    msg.setCharacterSize(16);
-    msg.setFillColor(sf::Color::White);
+    sf::Text& msg = texts.get(TEXT_HINT_MESSAGE, h.message, 16, sf::Color::White);
     msg.setPosition(sf::Vector2f(BOARD_OFFSET_X + 10.f, BOARD_OFFSET_Y - 60.f));
-    window.draw(msg);
+    RenderStats::draw(window, msg);
 
     if (!h.candidates.empty()) {
         std::string candStr = "Candidates: ";
@@ -394,30 +297,99 @@ void GameScreen::drawHintOverlay() {
             candStr += std::to_string(h.candidates[i]);
             if (i + 1 < h.candidates.size()) candStr += ", ";
         }
-        sf::Text cand(font);
-        cand.setString(candStr);
-        cand.setCharacterSize(14);
-        cand.setFillColor(sf::Color(180, 180, 200));
+        sf::Text& cand = texts.get(TEXT_HINT_CANDIDATES, candStr, 14, sf::Color(180, 180, 200));
         cand.setPosition(sf::Vector2f(BOARD_OFFSET_X + 10.f, BOARD_OFFSET_Y - 38.f));
-        window.draw(cand);
+        RenderStats::draw(window, cand);
     }
 
     if (h.value > 0) {
         sf::RectangleShape applyBtn(sf::Vector2f(90.f, 30.f));
         applyBtn.setPosition(sf::Vector2f(BOARD_OFFSET_X + 500.f - 100.f, BOARD_OFFSET_Y - 60.f));
         applyBtn.setFillColor(HINT_COLOR);
-        window.draw(applyBtn);
+        RenderStats::draw(window, applyBtn);
 
-        sf::Text applyText(font);
-        applyText.setString("Apply");
-        applyText.setCharacterSize(14);
-        applyText.setFillColor(sf::Color::White);
+        sf::Text& applyText = texts.get(TEXT_HINT_APPLY, "Apply", 14, sf::Color::White);
         sf::FloatRect t = applyText.getLocalBounds();
         applyText.setPosition(sf::Vector2f(BOARD_OFFSET_X + 500.f - 100.f + (90.f - t.size.x)/2.f, BOARD_OFFSET_Y - 60.f + (30.f - t.size.y)/2.f - 3.f));
-        window.draw(applyText);
+        RenderStats::draw(window, applyText);
     }
 }
 
+static std::string formatMs(float micros) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2) << micros / 1000.f << " ms";
+    return oss.str();
+}
+
+void GameScreen::drawPerfOverlay() {
+    if (!showPerf) return;
+
+    // Frame time histogram buckets: < 0.5 ms, < 1 ms, ... < 33 ms, >= 33 ms.
+    static const float BUCKET_LIMITS_MS[] = { 0.5f, 1.f, 2.f, 4.f, 8.f, 16.f, 33.f };
+    static const char* BUCKET_LABELS[] = { "<.5", "<1", "<2", "<4", "<8", "<16", "<33", "33+" };
+    constexpr int BUCKETS = 8;
+    static_assert(BUCKETS <= TEXT_PERF_BUCKET_END - TEXT_PERF_BUCKET, "one text slot per bucket label");
+
+    std::array<float, PerfChannel::CAPACITY> samples;
+    std::size_t count = PerfStats::Channel("frame").Snapshot(samples);
+    int buckets[BUCKETS] = {};
+    float sum = 0.f, worst = 0.f;
+    for (std::size_t i = 0; i < count; ++i) {
+        float ms = samples[i] / 1000.f;
+        int b = 0;
+        while (b < BUCKETS - 1 && ms >= BUCKET_LIMITS_MS[b]) ++b;
+        ++buckets[b];
+        sum += samples[i];
+        worst = std::max(worst, samples[i]);
+    }
+
+    std::ostringstream oss;
+    oss << "frame  last " << formatMs(PerfStats::Channel("frame").Last())
+        << "  avg " << formatMs(count ? sum / count : 0.f)
+        << "  max " << formatMs(worst) << "\n"
+        << "allocations/frame  " << PerfStats::Channel("frame.allocs").Last() << "\n"
+        << "generate  " << formatMs(PerfStats::Channel("generate").Last()) << "\n"
+        << "observers  " << formatMs(PerfStats::Channel("observers").Last()) << "\n";
+    for (const auto& channel : PerfStats::Channels()) {
+        if (channel.first.compare(0, 4, "hint") == 0) {
+            oss << channel.first << "  " << formatMs(channel.second->Last()) << "\n";
+        }
+    }
+
+    const float panelX = 360.f, panelY = BOARD_OFFSET_Y + 5.f, panelWidth = 330.f;
+    sf::Text& stats = texts.get(TEXT_PERF_STATS, oss.str(), 13, sf::Color::White);
+    stats.setPosition(sf::Vector2f(panelX + 10.f, panelY + 8.f));
+
+    const float chartY = panelY + 8.f + stats.getLocalBounds().size.y + 20.f;
+    const float chartHeight = 50.f, barWidth = 36.f, barGap = 3.f;
+
+    sf::RectangleShape panel(sf::Vector2f(panelWidth, chartY + chartHeight + 28.f - panelY));
+    panel.setPosition(sf::Vector2f(panelX, panelY));
+    panel.setFillColor(sf::Color(20, 20, 30, 220));
+    RenderStats::draw(window, panel);
+    RenderStats::draw(window, stats);
+
+    int maxBucket = *std::max_element(buckets, buckets + BUCKETS);
+    sf::VertexArray bars(sf::PrimitiveType::Triangles);
+    for (int b = 0; b < BUCKETS; ++b) {
+        float x = panelX + 10.f + b * (barWidth + barGap);
+        float h = maxBucket ? chartHeight * buckets[b] / maxBucket : 0.f;
+        sf::Color color = b < 5 ? SUCCESS_COLOR : (b < 6 ? WARNING_COLOR : DANGER_COLOR);
+        sf::Vector2f tl(x, chartY + chartHeight - h), br(x + barWidth, chartY + chartHeight);
+        bars.append(sf::Vertex{ tl, color });
+        bars.append(sf::Vertex{ sf::Vector2f(br.x, tl.y), color });
+        bars.append(sf::Vertex{ br, color });
+        bars.append(sf::Vertex{ tl, color });
+        bars.append(sf::Vertex{ br, color });
+        bars.append(sf::Vertex{ sf::Vector2f(tl.x, br.y), color });
+
+        sf::Text& label = texts.get(TEXT_PERF_BUCKET + b, BUCKET_LABELS[b], 11, sf::Color(180, 180, 200));
+        label.setPosition(sf::Vector2f(x + (barWidth - label.getLocalBounds().size.x) / 2.f, chartY + chartHeight + 4.f));
+        RenderStats::draw(window, label);
+    }
+    RenderStats::draw(window, bars);
+}
+
 bool GameScreen::isMouseOverCell(int mx, int my, int& r, int& c) {
     if (mx < BOARD_OFFSET_X || my < BOARD_OFFSET_Y) return false;
     mx -= BOARD_OFFSET_X;
@@ -462,10 +434,7 @@ void GameScreen::handleMouseClick(int x, int y) {
     );
 
     if (hintRect.contains(mousePos)) {
-        currentHint.reset();
-        if (manager.getHintManager() && game) {
-            currentHint = manager.getHintManager()->next(*game);
-        }
+        requestHint();
         return;
     }
 
@@ -493,14 +462,27 @@ void GameScreen::handleMouseClick(int x, int y) {
 }
 
 void GameScreen::handleKeyPress(sf::Keyboard::Key key) {
+    if (key == sf::Keyboard::Key::F3) {
+        showPerf = !showPerf;
+        return;
+    }
+
     if (!game) return;
     if (gameWon || gameLost) return;
 
     if (key == sf::Keyboard::Key::H) {
-        currentHint.reset();
-        if (manager.getHintManager()) {
-            currentHint = manager.getHintManager()->next(*game);
-        }
+        requestHint();
+        return;
+    }
+
+    const bool ctrl = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LControl) ||
+        sf::Keyboard::isKeyPressed(sf::Keyboard::Key::RControl);
+    if (ctrl && key == sf::Keyboard::Key::Z) {
+        game->undo();
+        return;
+    }
+    if (ctrl && key == sf::Keyboard::Key::Y) {
+        game->redo();
         return;
     }
 
@@ -537,9 +519,67 @@ void GameScreen::handleTextInput(std::uint32_t unicode) {
     }
 }
 
-void GameScreen::onBoardChanged() {}
+void GameScreen::requestHint() {
+    currentHint.reset();
+    if (precomputer) {
+        hintRequested = true;
+        collectHint();
+        return;
+    }
+
+    auto provider = manager.getHintManager();
+    if (provider && game) {
+        pendingHint = manager.getHintService().request(provider, *game);
+    }
+}
+
+bool GameScreen::collectHint() {
+    if (hintRequested) {
+        std::optional<Hint> hint;
+        if (!precomputer->current(hint)) return false;
+        currentHint = std::move(hint);
+        hintRequested = false;
+        manager.getRecorder().RecordHint(currentHint);
+        return true;
+    }
+
+    if (!pendingHint.valid()) return false;
+    if (pendingHint.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+
+    try {
+        AsyncHintService::Result result = pendingHint.get();
+        // Drop hints computed for a board the player has changed since.
+        if (game && result.board->matches(*game)) {
+            currentHint = std::move(result.hint);
+            manager.getRecorder().RecordHint(currentHint);
+        }
+    }
+    catch (...) {
+        // Strategy failure: no hint.
+    }
+    return true;
+}
+
+bool GameScreen::hintReady() const {
+    if (hintRequested) return precomputer->ready();
+    return pendingHint.valid() && pendingHint.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool GameScreen::needsRedraw() const {
+    // A finished hint is picked up by render().
+    if (hintReady()) return true;
+    if (boardDirty || showPerf) return true;
+    return game && game->getElapsedTime() != lastDrawnSeconds;
+}
+
+bool GameScreen::isWaiting() const {
+    return hintRequested || pendingHint.valid();
+}
+
+void GameScreen::onBoardChanged() { boardDirty = true; }
 void GameScreen::onGameComplete() {
     gameWon = true;
+    boardDirty = true;
 
     if (game) {
         std::string diffStr;
@@ -557,4 +597,7 @@ void GameScreen::onGameComplete() {
     }
 }
 
-void GameScreen::onAttemptsChanged(int remaining) { if (remaining <= 0) gameLost = true; }
\ No newline at end of file
+void GameScreen::onAttemptsChanged(int remaining) {
+    if (remaining <= 0) gameLost = true;
+    boardDirty = true;
+}
\ No newline at end of file
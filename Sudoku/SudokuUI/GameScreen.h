@@ -2,10 +2,18 @@
 #include "IScreen.h"
 #include "IObserver.h"
 #include "ScoreManager.h"
+#include "BoardRenderer.h"
+#include "StaticLayer.h"
+#include "TextCache.h"
+#include "../SudokuLib/Difficulty.h"
 #include <SFML/Graphics.hpp>
+#include <atomic>
+#include <future>
 #include <memory>
 #include <string>
 #include "../SudokuLib/Hint.h"
+#include "../SudokuLib/AsyncHintService.h"
+#include "../SudokuLib/HintPrecomputer.h"
 
 class ScreenManager;
 class ISudokuGame;
@@ -14,14 +22,51 @@ class GameScreen : public IObserver, public IScreen {
 private:
     ScreenManager& manager;
     ISudokuGame* game;
-    sf::RenderWindow& window;
+    sf::RenderTarget& window;
     sf::Font& font;
+    BoardRenderer boardRenderer;
+
+    // HUD, overlay and hint texts, laid out again only when their strings change.
+    TextCache texts;
+    enum TextId {
+        TEXT_LIVES,
+        TEXT_TIMER,
+        TEXT_OVERLAY_TITLE,
+        TEXT_OVERLAY_INFO,
+        TEXT_OVERLAY_CLICK,
+        TEXT_HINT_MESSAGE,
+        TEXT_HINT_CANDIDATES,
+        TEXT_HINT_APPLY,
+        TEXT_PERF_STATS,
+        TEXT_DIGIT_COUNT,
+        // One slot per frame-time bucket label; keep last.
+        TEXT_PERF_BUCKET,
+        TEXT_PERF_BUCKET_END = TEXT_PERF_BUCKET + 8
+    };
+
+    // Background, header, badges, help text and buttons; repainted when the difficulty changes.
+    StaticLayer chrome;
+    Difficulty chromeDifficulty = Difficulty::MEDIUM;
     int selectedRow;
     int selectedCol;
     bool gameWon;
     bool gameLost;
 
     std::optional<Hint> currentHint;
+    // Hint being computed in the background; collected without waiting.
+    std::future<AsyncHintService::Result> pendingHint;
+    // Precomputes the next hint after every move when enabled in ScreenManager.
+    std::unique_ptr<HintPrecomputer> precomputer;
+    // A hint was asked for and the precomputer has not finished it yet.
+    bool hintRequested = false;
+
+    // Set by observer callbacks (possibly from the generator thread).
+    std::atomic<bool> boardDirty{ true };
+    // Timer value shown by the last frame; a new second means a redraw.
+    int lastDrawnSeconds = -1;
+
+    // F3 debug overlay with frame time histogram and hot-path timings.
+    bool showPerf = false;
 
     static constexpr float CELL_SIZE = 60.0f;
     static constexpr float BOARD_OFFSET_X = 50.0f;
@@ -32,30 +77,32 @@ private:
     sf::Color BACKGROUND_COLOR = sf::Color(250, 250, 250);
     sf::Color GRID_COLOR = sf::Color(40, 40, 40);
     sf::Color SELECTED_COLOR = sf::Color(180, 220, 255);
-    sf::Color FIXED_COLOR = sf::Color(30, 30, 30);
-    sf::Color FILLED_COLOR = sf::Color(50, 120, 200);
     sf::Color PRIMARY_COLOR = sf::Color(99, 102, 241);
     sf::Color SUCCESS_COLOR = sf::Color(34, 197, 94);
     sf::Color WARNING_COLOR = sf::Color(251, 146, 60);
     sf::Color DANGER_COLOR = sf::Color(239, 68, 68);
     sf::Color HINT_COLOR = sf::Color(16, 185, 129); // teal green
 
-    void drawGrid();
-    void drawNumbers();
-    void drawSelection();
-    void drawHighlights();
+    void drawChrome(sf::RenderTarget& target);
     void drawInfo();
     void drawGameOverlay();
     bool isMouseOverCell(int mouseX, int mouseY, int& row, int& col);
 
     void drawHintOverlay();
+    void requestHint();
+    bool collectHint();
+    bool hintReady() const;
+    void drawPerfOverlay();
 
 public:
-    explicit GameScreen(ScreenManager& mgr, sf::RenderWindow& win);
-    void render(sf::RenderWindow& window) override;
+    explicit GameScreen(ScreenManager& mgr, sf::RenderTarget& win);
+    ~GameScreen() override;
+    void render(sf::RenderTarget& window) override;
     void handleMouseClick(int mouseX, int mouseY) override;
     void handleKeyPress(sf::Keyboard::Key key) override;
     void handleTextInput(std::uint32_t unicode) override;
+    bool needsRedraw() const override;
+    bool isWaiting() const override;
 
     void onBoardChanged() override;
     void onGameComplete() override;
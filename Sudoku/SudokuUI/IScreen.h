@@ -3,10 +3,20 @@
 
 class IScreen {
 public:
-    virtual void render(sf::RenderWindow& window) = 0;
+    // Draw the current frame into target. The caller presents it (window.display()),
+    // so screens can also be rendered off-screen.
+    virtual void render(sf::RenderTarget& target) = 0;
     virtual void handleMouseClick(int x, int y) = 0;
     virtual void handleKeyPress(sf::Keyboard::Key key) = 0;
     virtual void handleTextInput(uint32_t unicode) = 0;
 
+    // Whether the screen changed without user input (observer events, timers)
+    // and has to be drawn again. Input events always trigger a redraw.
+    // Must not change the screen; background results are collected in render().
+    virtual bool needsRedraw() const { return false; }
+
+    // Whether the screen waits for background work and wants to be polled often.
+    virtual bool isWaiting() const { return false; }
+
     virtual ~IScreen() = default;
 };
@@ -1,26 +1,27 @@
 #include "LeaderboardScreen.h"
 #include "ScoreManager.h"
+#include "RenderStats.h"
 #include <algorithm>
 #include <sstream>
 #include <SFML/Graphics.hpp>
 
-LeaderboardScreen::LeaderboardScreen(ScreenManager& mgr, sf::RenderWindow& win)
-    : manager(mgr), window(win), showLeaderboard(true), leaderboardTab(0) {
+LeaderboardScreen::LeaderboardScreen(ScreenManager& mgr, sf::RenderTarget& win)
+    : manager(mgr), window(win), showLeaderboard(true), leaderboardTab(0), texts(mgr.getFont()) {
 }
 
-void LeaderboardScreen::drawLeaderboard() {
+void LeaderboardScreen::drawStatic(sf::RenderTarget& target) {
     sf::Font& font = manager.getFont();
 
     sf::RectangleShape overlay(sf::Vector2f(700, 800));
     overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    window.draw(overlay);
+    RenderStats::draw(target, overlay);
 
     sf::RectangleShape leaderWindow(sf::Vector2f(600, 650));
     leaderWindow.setPosition(sf::Vector2f(50, 75));
     leaderWindow.setFillColor(sf::Color(245, 245, 245));
     leaderWindow.setOutlineColor(sf::Color(50, 50, 50));
     leaderWindow.setOutlineThickness(4);
-    window.draw(leaderWindow);
+    RenderStats::draw(target, leaderWindow);
 
     sf::Text title(font);
     title.setString("LEADERBOARD");
@@ -29,8 +30,35 @@ void LeaderboardScreen::drawLeaderboard() {
     title.setStyle(sf::Text::Bold);
     sf::FloatRect titleBounds = title.getLocalBounds();
     title.setPosition(sf::Vector2f(350 - titleBounds.size.x / 2, 100));
-    window.draw(title);
+    RenderStats::draw(target, title);
 
+    sf::Text header(font);
+    header.setString("Rank\tUsername\t\tTime");
+    header.setCharacterSize(20);
+    header.setFillColor(sf::Color(50, 50, 50));
+    header.setStyle(sf::Text::Bold);
+    header.setPosition(sf::Vector2f(100, 225));
+    RenderStats::draw(target, header);
+
+    sf::RectangleShape closeBtn(sf::Vector2f(120, 45));
+    closeBtn.setPosition(sf::Vector2f(290, 660));
+    closeBtn.setFillColor(sf::Color(200, 70, 70));
+    RenderStats::draw(target, closeBtn);
+
+    sf::Text closeText(font);
+    closeText.setString("Close");
+    closeText.setCharacterSize(22);
+    closeText.setFillColor(sf::Color::White);
+    closeText.setStyle(sf::Text::Bold);
+    sf::FloatRect closeBounds = closeText.getLocalBounds();
+    closeText.setPosition(sf::Vector2f(
+        290 + (120 - closeBounds.size.x) / 2,
+        660 + (45 - closeBounds.size.y) / 2 - 3
+    ));
+    RenderStats::draw(target, closeText);
+}
+
+void LeaderboardScreen::drawLeaderboard() {
     float tabY = 165;
     float tabWidth = 120;
     float tabHeight = 40;
@@ -44,81 +72,67 @@ void LeaderboardScreen::drawLeaderboard() {
         sf::RectangleShape tab(sf::Vector2f(tabWidth, tabHeight));
         tab.setPosition(sf::Vector2f(tabStartX + i * (tabWidth + tabSpacing), tabY));
         tab.setFillColor(i == leaderboardTab ? tabColors[i] : sf::Color(200, 200, 200));
-        window.draw(tab);
+        RenderStats::draw(window, tab);
 
-        sf::Text tabText(font);
-        tabText.setString(tabNames[i]);
-        tabText.setCharacterSize(18);
-        tabText.setFillColor(i == leaderboardTab ? sf::Color::White : sf::Color(80, 80, 80));
-        tabText.setStyle(sf::Text::Bold);
+        sf::Text& tabText = texts.get(TEXT_TAB + i, tabNames[i], 18,
+            i == leaderboardTab ? sf::Color::White : sf::Color(80, 80, 80), sf::Text::Bold);
         sf::FloatRect tabBounds = tabText.getLocalBounds();
         tabText.setPosition(sf::Vector2f(
             tabStartX + i * (tabWidth + tabSpacing) + (tabWidth - tabBounds.size.x) / 2,
             tabY + (tabHeight - tabBounds.size.y) / 2 - 3
         ));
-        window.draw(tabText);
+        RenderStats::draw(window, tabText);
     }
 
-    sf::Text header(font);
-    header.setString("Rank\tUsername\t\tTime");
-    header.setCharacterSize(20);
-    header.setFillColor(sf::Color(50, 50, 50));
-    header.setStyle(sf::Text::Bold);
-    header.setPosition(sf::Vector2f(100, 225));
-    window.draw(header);
-
     std::string filterDiff = (leaderboardTab == 0 ? "Easy" : (leaderboardTab == 1 ? "Medium" : "Hard"));
-    auto scores = ScoreManager::getScoresForDifficulty(filterDiff);
+    const auto& scores = ScoreManager::getTopScores(filterDiff);
+
+    // Format the rows only when the tab or its scores change.
+    if (leaderboardTab != shownTab || scores != shownScores) {
+        shownTab = leaderboardTab;
+        shownScores = scores;
+        rowStrings.clear();
+        int rank = 1;
+        for (size_t i = 0; i < std::min(scores.size(), size_t(10)); ++i) {
+            std::ostringstream oss;
+            oss << rank << ".\t" << scores[i].first << "\t\t" << ScoreManager::formatTime(scores[i].second);
+            rowStrings.push_back(oss.str());
+            rank++;
+        }
+    }
 
     float yPos = 275;
-    int rank = 1;
-    for (size_t i = 0; i < std::min(scores.size(), size_t(10)); ++i) {
-        std::ostringstream oss;
-        oss << rank << ".\t" << scores[i].first << "\t\t" << ScoreManager::formatTime(scores[i].second);
-
-        sf::Text entry(font);
-        entry.setString(oss.str());
-        entry.setCharacterSize(18);
-        entry.setFillColor(sf::Color(50, 50, 50));
+    for (size_t i = 0; i < rowStrings.size(); ++i) {
+        sf::Text& entry = texts.get(TEXT_ROW + static_cast<int>(i), rowStrings[i], 18, sf::Color(50, 50, 50));
         entry.setPosition(sf::Vector2f(100, yPos));
-        window.draw(entry);
+        RenderStats::draw(window, entry);
         yPos += 35;
-        rank++;
     }
 
     if (scores.empty()) {
-        sf::Text noData(font);
-        noData.setString("No scores for this difficulty yet!");
-        noData.setCharacterSize(20);
-        noData.setFillColor(sf::Color(150, 150, 150));
+        sf::Text& noData = texts.get(TEXT_NO_DATA, "No scores for this difficulty yet!", 20, sf::Color(150, 150, 150));
         sf::FloatRect noBounds = noData.getLocalBounds();
         noData.setPosition(sf::Vector2f(350 - noBounds.size.x / 2, 400));
-        window.draw(noData);
+        RenderStats::draw(window, noData);
     }
 
-    sf::RectangleShape closeBtn(sf::Vector2f(120, 45));
-    closeBtn.setPosition(sf::Vector2f(290, 660));
-    closeBtn.setFillColor(sf::Color(200, 70, 70));
-    window.draw(closeBtn);
-
-    sf::Text closeText(font);
-    closeText.setString("Close");
-    closeText.setCharacterSize(22);
-    closeText.setFillColor(sf::Color::White);
-    closeText.setStyle(sf::Text::Bold);
-    sf::FloatRect closeBounds = closeText.getLocalBounds();
-    closeText.setPosition(sf::Vector2f(
-        290 + (120 - closeBounds.size.x) / 2,
-        660 + (45 - closeBounds.size.y) / 2 - 3
-    ));
-    window.draw(closeText);
+    int userRank = ScoreManager::getRank(manager.getUsername(), filterDiff);
+    if (userRank > 0) {
+        sf::Text& rankText = texts.get(TEXT_RANK, "You are #" + std::to_string(userRank) + " of " +
+            std::to_string(ScoreManager::getScoreCount(filterDiff)), 18, sf::Color(70, 130, 180), sf::Text::Bold);
+        sf::FloatRect rankBounds = rankText.getLocalBounds();
+        rankText.setPosition(sf::Vector2f(350 - rankBounds.size.x / 2, 622));
+        RenderStats::draw(window, rankText);
+    }
 }
 
-void LeaderboardScreen::render(sf::RenderWindow& window) {
+void LeaderboardScreen::render(sf::RenderTarget& window) {
     if (!showLeaderboard) return;
-    window.clear(sf::Color(240, 242, 245));
+    layer.draw(window, [this](sf::RenderTarget& target) {
+        target.clear(sf::Color(240, 242, 245));
+        drawStatic(target);
+    });
     drawLeaderboard();
-    window.display();
 }
 
 void LeaderboardScreen::handleMouseClick(int x, int y) {
@@ -1,21 +1,44 @@
 #pragma once
 #include "IScreen.h"
 #include "ScreenManager.h"
+#include "StaticLayer.h"
+#include "TextCache.h"
 #include <SFML/Graphics.hpp>
+#include <string>
+#include <utility>
+#include <vector>
 
 class LeaderboardScreen : public IScreen {
 private:
     ScreenManager& manager;
-    sf::RenderWindow& window;
+    sf::RenderTarget& window;
     bool showLeaderboard;
     int leaderboardTab;
     bool ignoreFirstClick;
 
+    // Backdrop, panel, title, column header and close button.
+    StaticLayer layer;
+
+    // Tab labels, score rows and footer texts.
+    TextCache texts;
+    enum TextId {
+        TEXT_NO_DATA,
+        TEXT_RANK,
+        TEXT_TAB,
+        TEXT_ROW = TEXT_TAB + 3
+    };
+
+    // Scores behind rowStrings, to skip formatting when nothing changed.
+    int shownTab = -1;
+    std::vector<std::pair<std::string, int>> shownScores;
+    std::vector<std::string> rowStrings;
+
+    void drawStatic(sf::RenderTarget& target);
     void drawLeaderboard();
 
 public:
-    explicit LeaderboardScreen(ScreenManager& mgr, sf::RenderWindow& win);
-    void render(sf::RenderWindow& window) override;
+    explicit LeaderboardScreen(ScreenManager& mgr, sf::RenderTarget& win);
+    void render(sf::RenderTarget& window) override;
     void handleMouseClick(int x, int y) override;
     void handleKeyPress(sf::Keyboard::Key key) override;
     void handleTextInput(uint32_t unicode) override;
@@ -0,0 +1,16 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+// SFML does not report how many draw calls a frame issues, so the UI draws
+// through RenderStats::draw(), which forwards to the target and counts. The
+// benchmark harness reads and resets the counter around every frame.
+namespace RenderStats {
+    inline std::size_t drawCalls = 0;
+
+    inline void draw(sf::RenderTarget& target, const sf::Drawable& drawable,
+        const sf::RenderStates& states = sf::RenderStates::Default) {
+        ++drawCalls;
+        target.draw(drawable, states);
+    }
+}
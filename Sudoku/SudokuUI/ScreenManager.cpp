@@ -4,9 +4,10 @@
 #include "GameScreen.h"
 #include "LeaderboardScreen.h"
 
-#include <thread>
-#include "../SudokuLib/GameFactory.h"
 #include "../SudokuLib/HintFactory.h"
+#include "../SudokuLib/GameSave.h"
+#include <chrono>
+#include <filesystem>
 
 ScreenManager::ScreenManager(sf::Font& font)
     : currentScreen(nullptr), currentType(ScreenType::Username),
@@ -14,8 +15,18 @@ ScreenManager::ScreenManager(sf::Font& font)
 {
 }
 
-void ScreenManager::setScreen(ScreenType type, sf::RenderWindow& window) {
+ScreenManager::~ScreenManager() {
+    // Screens observe the game and use the hint service; destroy them first.
+    currentScreen.reset();
+    // Final save of the game, including the time since the last move.
+    autoSaver.reset();
+    saveSession();
+}
+
+void ScreenManager::setScreen(ScreenType type, sf::RenderTarget& window) {
     currentType = type;
+    // Leaving the game screen abandons a game that is still being generated.
+    if (type != ScreenType::Game) gameCreator.cancel();
 
     switch (type) {
     case ScreenType::Username:
@@ -36,16 +47,61 @@ void ScreenManager::setScreen(ScreenType type, sf::RenderWindow& window) {
     }
 }
 
-void ScreenManager::createGame(Difficulty difficulty, sf::RenderWindow& window) {
-    gamePtr = CreateSudokuGame(difficulty);
+void ScreenManager::createGame(Difficulty difficulty, sf::RenderTarget& window) {
+    gameCreator.start(difficulty);
+
+    // Screens observe the current game, so drop them before the game.
+    currentScreen.reset();
+    autoSaver.reset();
+    saveSession();
+    gamePtr.reset();
     hintMgr = CreateHintManager(difficulty);
 
     setScreen(ScreenType::Game, window);
-    std::thread([this]() {
-        if (gamePtr) {
-            gamePtr->startNewGame();
-        }
-    }).detach();
+}
+
+void ScreenManager::installGame(std::unique_ptr<SudokuGame> game, sf::RenderTarget& window) {
+    currentScreen.reset();
+    autoSaver.reset();
+    saveSession();
+    gamePtr = std::move(game);
+    // Moves only queue notifications; the main loop delivers them on the UI thread.
+    gamePtr->setDispatchMode(ObserverDispatcher::Mode::Queued);
+    if (saveGames) {
+        autoSaver = std::make_unique<GameAutoSaver>(*gamePtr);
+        recorder.Begin(*gamePtr);
+        gamePtr->setRecorder(&recorder);
+    }
+    setScreen(ScreenType::Game, window);
+}
+
+void ScreenManager::saveSession() {
+    if (!saveGames || !gamePtr || recorder.Size() == 0) return;
+    gamePtr->setRecorder(nullptr);
+
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::create_directories("sessions", ec);
+    auto stamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    recorder.Log().Write("sessions/" + std::to_string(stamp) + ".sdkr");
+}
+
+bool ScreenManager::hasSavedGame() const {
+    return saveGames && GameSave::Exists(GameSave::DEFAULT_FILE);
+}
+
+bool ScreenManager::resumeGame(sf::RenderTarget& window) {
+    GameSave::Buffer buffer;
+    if (!saveGames || !GameSave::Read(GameSave::DEFAULT_FILE, buffer)) return false;
+
+    auto game = std::make_unique<SudokuGame>();
+    if (!game->loadState(buffer)) return false;
+
+    gameCreator.cancel();
+    hintMgr = CreateHintManager(game->getCurrentDifficulty());
+    installGame(std::move(game), window);
+    return true;
 }
 
 void ScreenManager::requestScreen(ScreenType type) {
@@ -58,7 +114,9 @@ void ScreenManager::requestCreateGame(Difficulty difficulty) {
     pendingCreateDifficulty = difficulty;
 }
 
-void ScreenManager::applyPending(sf::RenderWindow& window) {
+bool ScreenManager::applyPending(sf::RenderTarget& window) {
+    bool applied = hasPendingScreen || hasPendingCreate;
+
     if (hasPendingScreen) {
         setScreen(pendingScreen, window);
         hasPendingScreen = false;
@@ -68,4 +126,16 @@ void ScreenManager::applyPending(sf::RenderWindow& window) {
         createGame(pendingCreateDifficulty, window);
         hasPendingCreate = false;
     }
+
+    // Hand a finished game over to a fresh game screen on this thread.
+    if (std::unique_ptr<SudokuGame> created = gameCreator.poll()) {
+        installGame(std::move(created), window);
+        applied = true;
+    }
+
+    return applied;
+}
+
+std::size_t ScreenManager::deliverGameEvents() {
+    return gamePtr ? gamePtr->deliverEvents() : 0;
 }
\ No newline at end of file
@@ -5,6 +5,10 @@
 #include "../SudokuLib/ISudokuGame.h"
 #include "../SudokuLib/Difficulty.h"
 #include "../SudokuLib/IHintProvider.h"
+#include "../SudokuLib/AsyncHintService.h"
+#include "../SudokuLib/AsyncGameCreator.h"
+#include "../SudokuLib/GameAutoSaver.h"
+#include "../SudokuLib/SessionRecorder.h"
 #include <string>
 
 enum class ScreenType {
@@ -19,8 +23,21 @@ private:
     std::unique_ptr<IScreen> currentScreen;
     ScreenType currentType;
 
-    std::unique_ptr<ISudokuGame> gamePtr;
-    std::unique_ptr<IHintProvider> hintMgr;
+    // Records the current game's moves for replay; written to sessions/ when the game is replaced.
+    SessionRecorder recorder;
+    std::unique_ptr<SudokuGame> gamePtr;
+    // Writes the current game to the save file after every move.
+    std::unique_ptr<GameAutoSaver> autoSaver;
+    // Generates the next game off the UI thread; applyPending() installs it.
+    AsyncGameCreator gameCreator;
+    // Shared with in-flight hint requests, which may outlive a game switch.
+    std::shared_ptr<IHintProvider> hintMgr;
+    AsyncHintService hintService;
+    // Compute the next hint in the background after every move.
+    bool precomputeHints = true;
+    // Autosave games and record their sessions. Off by default so tools such as
+    // the bench never touch the player's save file or sessions/.
+    bool saveGames = false;
     sf::Font& appFont;
 
     std::string username;
@@ -32,23 +49,47 @@ private:
     bool hasPendingCreate = false;
     Difficulty pendingCreateDifficulty;
 
+    // Make game the current one, start saving it if enabled and show it on a fresh game screen.
+    void installGame(std::unique_ptr<SudokuGame> game, sf::RenderTarget& window);
+    // Write the recorded session of the current game, if anything was played.
+    void saveSession();
+
 public:
     explicit ScreenManager(sf::Font& font);
+    ~ScreenManager();
 
-    void setScreen(ScreenType type, sf::RenderWindow& window);
+    void setScreen(ScreenType type, sf::RenderTarget& window);
 
     void requestScreen(ScreenType type);
     void requestCreateGame(Difficulty difficulty);
-    void applyPending(sf::RenderWindow& window);
+    // Returns true if a screen change, game creation or finished game was applied.
+    bool applyPending(sf::RenderTarget& window);
+    // Runs the current game's queued observer callbacks on this thread; returns how many ran.
+    std::size_t deliverGameEvents();
 
     IScreen* getScreen() { return currentScreen.get(); }
     ScreenType getCurrentType() const { return currentType; }
 
-    void createGame(Difficulty difficulty, sf::RenderWindow& window);
+    // Shows the game screen without a game and starts generating one in the
+    // background; applyPending() swaps it in when ready.
+    void createGame(Difficulty difficulty, sf::RenderTarget& window);
+    bool isCreatingGame() const { return gameCreator.busy(); }
+
+    // A game left unfinished in a previous session can be resumed.
+    bool hasSavedGame() const;
+    // Restores the saved game without generating a puzzle; false if the save is unreadable.
+    bool resumeGame(sf::RenderTarget& window);
 
     sf::Font& getFont() { return appFont; }
     ISudokuGame* getGame() { return gamePtr ? gamePtr.get() : nullptr; }
-    IHintProvider* getHintManager() { return hintMgr ? hintMgr.get() : nullptr; }
+    std::shared_ptr<IHintProvider> getHintManager() const { return hintMgr; }
+    AsyncHintService& getHintService() { return hintService; }
+    SessionRecorder& getRecorder() { return recorder; }
+    void setPrecomputeHints(bool enabled) { precomputeHints = enabled; }
+    bool getPrecomputeHints() const { return precomputeHints; }
+    // Applies to games installed from now on.
+    void setSaveGames(bool enabled) { saveGames = enabled; }
+    bool getSaveGames() const { return saveGames; }
 
     void setUsername(const std::string& name) { username = name; }
     const std::string& getUsername() const { return username; }
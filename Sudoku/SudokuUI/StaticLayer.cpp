@@ -0,0 +1,31 @@
+#include "StaticLayer.h"
+#include "RenderStats.h"
+
+void StaticLayer::draw(sf::RenderTarget& target, const Painter& paint) {
+    sf::Vector2u targetSize = target.getSize();
+
+    if (targetSize != size) {
+        if (!texture.resize(targetSize)) {
+            // No off-screen buffer available: draw directly, uncached.
+            size = sf::Vector2u(0, 0);
+            paint(target);
+            return;
+        }
+        size = targetSize;
+        valid = false;
+    }
+
+    if (!valid) {
+        // Paint at the target's pixel resolution with the same view, so the
+        // cached content lines up exactly with what paint(target) would draw.
+        texture.setView(target.getView());
+        paint(texture);
+        texture.display();
+        valid = true;
+    }
+
+    sf::View previous = target.getView();
+    target.setView(sf::View(sf::FloatRect(sf::Vector2f(0.f, 0.f), sf::Vector2f(size))));
+    RenderStats::draw(target, sf::Sprite(texture.getTexture()));
+    target.setView(previous);
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <functional>
+
+/**
+ * @brief Off-screen cache for the static part of a screen.
+ *
+ * The paint callback renders the static content (background, chrome, labels)
+ * into an sf::RenderTexture the first time the layer is drawn; later frames
+ * blit it with a single sprite. The layer is repainted after invalidate() or
+ * when the target size changes, e.g. after a window resize.
+ *
+ * The paint callback should fill the whole layer (typically by clearing to the
+ * screen background), so the layer replaces the window clear.
+ */
+class StaticLayer {
+public:
+    using Painter = std::function<void(sf::RenderTarget&)>;
+
+    /**
+     * @brief Draw the cached layer onto target, repainting it first if needed.
+     *
+     * @param target Target to draw into; its current view is used for painting.
+     * @param paint Callback that renders the static content.
+     */
+    void draw(sf::RenderTarget& target, const Painter& paint);
+
+    /**
+     * @brief Repaint the layer on the next draw().
+     */
+    void invalidate() { valid = false; }
+
+private:
+    sf::RenderTexture texture;
+    sf::Vector2u size{ 0, 0 };
+    bool valid = false;
+};
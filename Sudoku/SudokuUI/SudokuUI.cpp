@@ -71,44 +71,43 @@ void SudokuUI::drawSelection() {
 
 void SudokuUI::drawHighlights() {
     if (selectedRow >= 0 && selectedRow < 9 && selectedCol >= 0 && selectedCol < 9) {
-        int selectedValue = game->getValue(selectedRow, selectedCol);
+        const BoardView board = game->getBoardView();
+        int selectedValue = board.Value(selectedRow, selectedCol);
 
         if (selectedValue != 0) {
-            for (int row = 0; row < 9; row++) {
-                for (int col = 0; col < 9; col++) {
-                    if (game->getValue(row, col) == selectedValue) {
-                        if (row == selectedRow && col == selectedCol) continue;
-
-                        sf::RectangleShape highlight(sf::Vector2f(CELL_SIZE - 2, CELL_SIZE - 2));
-                        highlight.setPosition(sf::Vector2f(
-                            BOARD_OFFSET_X + col * CELL_SIZE + 1,
-                            BOARD_OFFSET_Y + row * CELL_SIZE + 1
-                        ));
-                        highlight.setFillColor(sf::Color(251, 146, 60, 120));
-                        window.draw(highlight);
-
-                        sf::RectangleShape highlightOutline(sf::Vector2f(CELL_SIZE, CELL_SIZE));
-                        highlightOutline.setPosition(sf::Vector2f(
-                            BOARD_OFFSET_X + col * CELL_SIZE,
-                            BOARD_OFFSET_Y + row * CELL_SIZE
-                        ));
-                        highlightOutline.setFillColor(sf::Color::Transparent);
-                        highlightOutline.setOutlineThickness(-3);
-                        highlightOutline.setOutlineColor(sf::Color(251, 146, 60, 200));
-                        window.draw(highlightOutline);
-                    }
-                }
-            }
+            board.Cells(selectedValue).ForEach([&](int cell) {
+                int row = cell / 9, col = cell % 9;
+                if (row == selectedRow && col == selectedCol) return;
+
+                sf::RectangleShape highlight(sf::Vector2f(CELL_SIZE - 2, CELL_SIZE - 2));
+                highlight.setPosition(sf::Vector2f(
+                    BOARD_OFFSET_X + col * CELL_SIZE + 1,
+                    BOARD_OFFSET_Y + row * CELL_SIZE + 1
+                ));
+                highlight.setFillColor(sf::Color(251, 146, 60, 120));
+                window.draw(highlight);
+
+                sf::RectangleShape highlightOutline(sf::Vector2f(CELL_SIZE, CELL_SIZE));
+                highlightOutline.setPosition(sf::Vector2f(
+                    BOARD_OFFSET_X + col * CELL_SIZE,
+                    BOARD_OFFSET_Y + row * CELL_SIZE
+                ));
+                highlightOutline.setFillColor(sf::Color::Transparent);
+                highlightOutline.setOutlineThickness(-3);
+                highlightOutline.setOutlineColor(sf::Color(251, 146, 60, 200));
+                window.draw(highlightOutline);
+            });
         }
     }
 }
 
 void SudokuUI::drawNumbers() {
+    const BoardView board = game->getBoardView();
     for (int row = 0; row < 9; row++) {
         for (int col = 0; col < 9; col++) {
-            int value = game->getValue(row, col);
+            int value = board.Value(row, col);
             if (value != 0) {
-                CellState state = game->getCellState(row, col);
+                CellState state = board.State(row, col);
 
                 sf::Text text(font);
                 text.setString(std::to_string(value));
@@ -510,7 +509,7 @@ void SudokuUI::drawLeaderboard() {
     case 2: filterDiff = "Hard"; break;
     }
 
-    auto scores = ScoreManager::getScoresForDifficulty(filterDiff);
+    const auto& scores = ScoreManager::getTopScores(filterDiff);
 
     float yPos = 275;
     int rank = 1;
@@ -0,0 +1,20 @@
+#include "TextCache.h"
+
+sf::Text& TextCache::get(int key, const std::string& str, unsigned int characterSize,
+    sf::Color color, std::uint32_t style) {
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        it = entries.emplace(key, Entry{ sf::Text(font, str, characterSize), str }).first;
+    }
+    else if (it->second.str != str) {
+        it->second.str = str;
+        it->second.text.setString(str);
+    }
+
+    // These setters are no-ops when the value is unchanged.
+    sf::Text& text = it->second.text;
+    text.setCharacterSize(characterSize);
+    text.setStyle(style);
+    text.setFillColor(color);
+    return text;
+}
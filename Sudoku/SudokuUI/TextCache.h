@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Keyed cache of laid-out sf::Text objects.
+ *
+ * Each key owns one sf::Text that lives across frames. get() only passes the
+ * string to SFML (UTF-32 conversion and glyph layout) when it differs from the
+ * one already shown, so per-frame HUD labels that rarely change cost a string
+ * comparison instead of a full relayout. Bounds queried on the returned text
+ * are cached by SFML until the next change.
+ */
+class TextCache {
+public:
+    explicit TextCache(const sf::Font& font) : font(font) {}
+
+    /**
+     * @brief Get the text for key, updating its string and style if they changed.
+     *
+     * @param key Caller-chosen identifier of the text slot.
+     * @param str String to display.
+     * @param characterSize Character size in pixels.
+     * @param color Fill color.
+     * @param style sf::Text::Style flags.
+     * @return The cached text, ready to be positioned and drawn.
+     */
+    sf::Text& get(int key, const std::string& str, unsigned int characterSize,
+        sf::Color color, std::uint32_t style = sf::Text::Regular);
+
+    /**
+     * @brief Drop every cached text.
+     */
+    void clear() { entries.clear(); }
+
+private:
+    struct Entry {
+        sf::Text text;
+        std::string str;
+    };
+
+    const sf::Font& font;
+    std::unordered_map<int, Entry> entries;
+};
@@ -1,24 +1,27 @@
 #include "UsernameScreen.h"
+#include "RenderStats.h"
 #include <SFML/Graphics.hpp>
 
-UsernameScreen::UsernameScreen(ScreenManager& mgr, sf::RenderWindow& win)
+UsernameScreen::UsernameScreen(ScreenManager& mgr, sf::RenderTarget& win)
     : manager(mgr), window(win), showUsernameInput(true), username(""), inputBuffer("")
 {
 }
 
-void UsernameScreen::render(sf::RenderWindow& window) {
-    window.clear(sf::Color(240, 242, 245));
+void UsernameScreen::render(sf::RenderTarget& window) {
+    layer.draw(window, [this](sf::RenderTarget& target) {
+        target.clear(sf::Color(240, 242, 245));
+        drawStatic(target);
+    });
     drawUsernameInput();
-    window.display();
 }
 
-void UsernameScreen::drawUsernameInput() {
+void UsernameScreen::drawStatic(sf::RenderTarget& target) {
     sf::Font& font = manager.getFont();
     const sf::Color PRIMARY_COLOR(99, 102, 241);
 
     sf::RectangleShape overlay(sf::Vector2f(700, 800));
     overlay.setFillColor(sf::Color(240, 242, 245));
-    window.draw(overlay);
+    RenderStats::draw(target, overlay);
 
     sf::Text icon(font);
     icon.setString("@");
@@ -27,7 +30,7 @@ void UsernameScreen::drawUsernameInput() {
     icon.setStyle(sf::Text::Bold);
     sf::FloatRect iconBounds = icon.getLocalBounds();
     icon.setPosition(sf::Vector2f(350 - iconBounds.size.x / 2, 180));
-    window.draw(icon);
+    RenderStats::draw(target, icon);
 
     sf::Text title(font);
     title.setString("Welcome to Sudoku!");
@@ -36,7 +39,7 @@ void UsernameScreen::drawUsernameInput() {
     title.setStyle(sf::Text::Bold);
     sf::FloatRect titleBounds = title.getLocalBounds();
     title.setPosition(sf::Vector2f(350 - titleBounds.size.x / 2, 280));
-    window.draw(title);
+    RenderStats::draw(target, title);
 
     sf::Text subtitle(font);
     subtitle.setString("Enter your username to begin");
@@ -44,26 +47,50 @@ void UsernameScreen::drawUsernameInput() {
     subtitle.setFillColor(sf::Color(100, 100, 120));
     sf::FloatRect subBounds = subtitle.getLocalBounds();
     subtitle.setPosition(sf::Vector2f(350 - subBounds.size.x / 2, 335));
-    window.draw(subtitle);
+    RenderStats::draw(target, subtitle);
 
     sf::RectangleShape inputShadow(sf::Vector2f(404, 64));
     inputShadow.setPosition(sf::Vector2f(148, 382));
     inputShadow.setFillColor(sf::Color(0, 0, 0, 20));
-    window.draw(inputShadow);
+    RenderStats::draw(target, inputShadow);
 
     sf::RectangleShape inputBox(sf::Vector2f(400, 60));
     inputBox.setPosition(sf::Vector2f(150, 380));
     inputBox.setFillColor(sf::Color::White);
     inputBox.setOutlineColor(PRIMARY_COLOR);
     inputBox.setOutlineThickness(2);
-    window.draw(inputBox);
+    RenderStats::draw(target, inputBox);
+
+    sf::RectangleShape startShadow(sf::Vector2f(184, 54));
+    startShadow.setPosition(sf::Vector2f(260, 482));
+    startShadow.setFillColor(sf::Color(0, 0, 0, 30));
+    RenderStats::draw(target, startShadow);
+
+    sf::RectangleShape leaderBtn(sf::Vector2f(180, 50));
+    leaderBtn.setPosition(sf::Vector2f(260, 540));
+    leaderBtn.setFillColor(sf::Color(200, 140, 0));
+    RenderStats::draw(target, leaderBtn);
+
+    sf::Text leaderText(font);
+    leaderText.setString("Leaderboard");
+    leaderText.setCharacterSize(18);
+    leaderText.setFillColor(sf::Color::White);
+    leaderText.setStyle(sf::Text::Bold);
+    sf::FloatRect lBounds = leaderText.getLocalBounds();
+    leaderText.setPosition(sf::Vector2f(260 + (180 - lBounds.size.x) / 2, 540 + (50 - lBounds.size.y) / 2 - 3));
+    RenderStats::draw(target, leaderText);
+}
+
+void UsernameScreen::drawUsernameInput() {
+    sf::Font& font = manager.getFont();
+    const sf::Color PRIMARY_COLOR(99, 102, 241);
 
     sf::Text inputText(font);
     inputText.setString(inputBuffer.empty() ? "" : inputBuffer);
     inputText.setCharacterSize(24);
     inputText.setFillColor(sf::Color(30, 30, 40));
     inputText.setPosition(sf::Vector2f(170, 393));
-    window.draw(inputText);
+    RenderStats::draw(window, inputText);
 
     if (inputBuffer.empty()) {
         sf::Text placeholder(font);
@@ -71,7 +98,7 @@ void UsernameScreen::drawUsernameInput() {
         placeholder.setCharacterSize(24);
         placeholder.setFillColor(sf::Color(150, 150, 160));
         placeholder.setPosition(sf::Vector2f(170, 393));
-        window.draw(placeholder);
+        RenderStats::draw(window, placeholder);
     }
 
     sf::Text cursor(font);
@@ -80,17 +107,12 @@ void UsernameScreen::drawUsernameInput() {
     cursor.setFillColor(PRIMARY_COLOR);
     sf::FloatRect inputBounds = inputText.getLocalBounds();
     cursor.setPosition(sf::Vector2f(175 + inputBounds.size.x, 390));
-    window.draw(cursor);
-
-    sf::RectangleShape startShadow(sf::Vector2f(184, 54));
-    startShadow.setPosition(sf::Vector2f(260, 482));
-    startShadow.setFillColor(sf::Color(0, 0, 0, 30));
-    window.draw(startShadow);
+    RenderStats::draw(window, cursor);
 
     sf::RectangleShape startBtn(sf::Vector2f(180, 50));
     startBtn.setPosition(sf::Vector2f(260, 480));
     startBtn.setFillColor(inputBuffer.empty() ? sf::Color(150, 150, 160) : PRIMARY_COLOR);
-    window.draw(startBtn);
+    RenderStats::draw(window, startBtn);
 
     sf::Text startText(font);
     startText.setString("Start Playing");
@@ -102,21 +124,7 @@ void UsernameScreen::drawUsernameInput() {
         350 - startBounds.size.x / 2,
         480 + (50 - startBounds.size.y) / 2 - 3
     ));
-    window.draw(startText);
-
-    sf::RectangleShape leaderBtn(sf::Vector2f(180, 50));
-    leaderBtn.setPosition(sf::Vector2f(260, 540));
-    leaderBtn.setFillColor(sf::Color(200, 140, 0));
-    window.draw(leaderBtn);
-
-    sf::Text leaderText(font);
-    leaderText.setString("Leaderboard");
-    leaderText.setCharacterSize(18);
-    leaderText.setFillColor(sf::Color::White);
-    leaderText.setStyle(sf::Text::Bold);
-    sf::FloatRect lBounds = leaderText.getLocalBounds();
-    leaderText.setPosition(sf::Vector2f(260 + (180 - lBounds.size.x) / 2, 540 + (50 - lBounds.size.y) / 2 - 3));
-    window.draw(leaderText);
+    RenderStats::draw(window, startText);
 }
 
 void UsernameScreen::handleMouseClick(int x, int y) {
@@ -1,23 +1,28 @@
 #pragma once
 #include "IScreen.h"
 #include "ScreenManager.h"
+#include "StaticLayer.h"
 #include <SFML/Graphics.hpp>
 #include <string>
 
 class UsernameScreen : public IScreen {
 private:
     ScreenManager& manager;
-    sf::RenderWindow& window;
+    sf::RenderTarget& window;
 
     bool showUsernameInput;
     std::string username;
     std::string inputBuffer;
 
+    // Icon, titles, input frame and the leaderboard button.
+    StaticLayer layer;
+
+    void drawStatic(sf::RenderTarget& target);
     void drawUsernameInput();
 
 public:
-    explicit UsernameScreen(ScreenManager& mgr, sf::RenderWindow& win);
-    void render(sf::RenderWindow& window) override;
+    explicit UsernameScreen(ScreenManager& mgr, sf::RenderTarget& win);
+    void render(sf::RenderTarget& window) override;
     void handleMouseClick(int x, int y) override;
     void handleKeyPress(sf::Keyboard::Key key) override;
     void handleTextInput(uint32_t unicode) override;
@@ -1,6 +1,11 @@
 ﻿#include "ScreenManager.h"
 #include "../SudokuLib/Difficulty.h"
+#include "../SudokuLib/PerfStats.h"
+// Count heap allocations for the F3 performance overlay.
+#define ALLOCATION_COUNTER_IMPLEMENTATION
+#include "../SudokuLib/AllocationCounter.h"
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <iostream>
 #include <optional>
 
@@ -15,17 +20,34 @@ int main() {
     }
 
     ScreenManager manager(font);
+    manager.setSaveGames(true);
 
     manager.setScreen(ScreenType::Username, window);
 
+    // Only redraw when something changed; when idle, sleep in waitEvent and wake
+    // up periodically so screens can report timer ticks via needsRedraw().
+    const sf::Time idleWait = sf::milliseconds(100);
+    // While a game is generated or a hint computed, wake up often to pick it up promptly.
+    const sf::Time busyWait = sf::milliseconds(5);
+    bool redraw = true;
+
+    PerfChannel& frameTime = PerfStats::Channel("frame");
+    PerfChannel& frameAllocations = PerfStats::Channel("frame.allocs");
+
     while (window.isOpen()) {
-        while (const std::optional<sf::Event> evt = window.pollEvent()) {
+        IScreen* waiting = manager.getScreen();
+        bool busy = manager.isCreatingGame() || (waiting && waiting->isWaiting());
+        std::optional<sf::Event> evt = redraw ? window.pollEvent()
+            : window.waitEvent(busy ? busyWait : idleWait);
+        for (; evt; evt = window.pollEvent()) {
             const auto& event = *evt;
             if (event.is<sf::Event::Closed>()) {
                 window.close();
                 break;
             }
 
+            if (!event.is<sf::Event::MouseMoved>()) redraw = true;
+
             IScreen* current = manager.getScreen();
             if (!current) continue;
 
@@ -41,12 +63,25 @@ int main() {
             else if (const auto* text = event.getIf<sf::Event::TextEntered>()) {
                 current->handleTextInput(text->unicode);
             }
+            // A winning or losing move must reach the screen before the next input.
+            manager.deliverGameEvents();
         }
 
-        manager.applyPending(window);
+        if (!window.isOpen()) break;
+        if (manager.applyPending(window)) redraw = true;
+        if (manager.deliverGameEvents() > 0) redraw = true;
 
         IScreen* screen = manager.getScreen();
-        if (screen) screen->render(window);
+        if (screen && (redraw || screen->needsRedraw())) {
+            std::uint64_t allocationsBefore = PerfStats::AllocationCount();
+            {
+                PerfStats::ScopedTimer timing(frameTime);
+                screen->render(window);
+            }
+            frameAllocations.Record(static_cast<float>(PerfStats::AllocationCount() - allocationsBefore));
+            window.display();
+            redraw = false;
+        }
     }
 
     return 0;